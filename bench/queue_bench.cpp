@@ -0,0 +1,135 @@
+/**
+ * @file queue_bench.cpp
+ * @brief ThreadSafeQueue와 SpscRingBuffer의 단일 생산자/단일 소비자 처리량 비교 벤치마크
+ *
+ * 생산자 스레드 하나가 아이템을 push하고 소비자 스레드 하나가 try_pop으로 꺼내는 동안의
+ * 초당 처리 건수를 측정합니다. 메트릭/로그 파이프라인과 같은 BoundedQueue 인터페이스로 호출합니다.
+ *
+ * 빌드: cmake -DBUILD_BENCHMARKS=ON .. && make queue_bench
+ * 실행: ./bin/queue_bench.exec [아이템 수] [큐 크기]
+ */
+
+#include "common/thread_safe_queue.h"
+#include "common/spsc_ring_buffer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+namespace
+{
+    /**
+     * @brief 벤치마크 결과
+     */
+    struct BenchResult
+    {
+        double seconds = 0.0;   ///< 전체 소요 시간 (초)
+        size_t received = 0;    ///< 소비자가 받은 아이템 수
+        uint64_t checksum = 0;  ///< 받은 아이템 검증용 합계
+    };
+
+    /**
+     * @brief 정수 아이템 생성
+     */
+    uint64_t makeItem(uint64_t i, uint64_t *) { return i; }
+
+    /**
+     * @brief 로그 메시지 크기의 문자열 아이템 생성
+     */
+    string makeItem(uint64_t i, string *) { return "benchmark log message payload #" + to_string(i); }
+
+    /**
+     * @brief 아이템 검증값 계산
+     */
+    uint64_t itemValue(uint64_t item) { return item; }
+
+    /**
+     * @brief 문자열 아이템 검증값 계산
+     */
+    uint64_t itemValue(const string &item) { return item.size(); }
+
+    /**
+     * @brief 큐 하나에 대해 생산자/소비자 처리량을 측정
+     *
+     * @tparam T 아이템 타입
+     * @param queue 측정할 큐
+     * @param count 전달할 아이템 수
+     * @return BenchResult 측정 결과
+     */
+    template <typename T>
+    BenchResult run(BoundedQueue<T> &queue, size_t count)
+    {
+        BenchResult result;
+        auto start = chrono::steady_clock::now();
+
+        thread consumer([&]()
+                        {
+            T item;
+            while (result.received < count && queue.try_pop(item, chrono::milliseconds(100)))
+            {
+                result.checksum += itemValue(item);
+                result.received++;
+            } });
+
+        for (size_t i = 0; i < count; i++)
+        {
+            queue.push(makeItem(i, static_cast<T *>(nullptr)));
+        }
+
+        consumer.join();
+        result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    /**
+     * @brief 결과 한 줄 출력
+     */
+    void report(const char *name, const BenchResult &result)
+    {
+        printf("%-28s %10zu건 %8.3f초 %12.0f건/초 (검증값 %llu)\n",
+               name, result.received, result.seconds,
+               result.seconds > 0.0 ? static_cast<double>(result.received) / result.seconds : 0.0,
+               static_cast<unsigned long long>(result.checksum));
+    }
+
+    /**
+     * @brief 아이템 타입 하나에 대해 두 큐를 비교
+     */
+    template <typename T>
+    void compare(const char *label, size_t count, size_t capacity)
+    {
+        string mutexName = string("mutex/") + label;
+        string spscName = string("spsc/") + label;
+
+        {
+            ThreadSafeQueue<T> queue(capacity);
+            report(mutexName.c_str(), run<T>(queue, count));
+        }
+        {
+            SpscRingBuffer<T> queue(capacity);
+            report(spscName.c_str(), run<T>(queue, count));
+        }
+    }
+}
+
+/**
+ * @brief 벤치마크 진입점
+ *
+ * @param argc 인수 개수
+ * @param argv [1] 아이템 수 (기본값: 1000000), [2] 큐 크기 (기본값: 1024)
+ * @return int 종료 코드
+ */
+int main(int argc, char **argv)
+{
+    size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t capacity = argc > 2 ? strtoull(argv[2], nullptr, 10) : 1024;
+
+    printf("아이템 수: %zu, 큐 크기: %zu\n", count, capacity);
+    compare<uint64_t>("uint64", count, capacity);
+    compare<string>("string", count, capacity);
+    return 0;
+}
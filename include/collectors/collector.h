@@ -1,5 +1,16 @@
 #pragma once
 
+#include "common/blocking_pool.h"
+#include "common/self_metrics.h"
+#include "common/worker_pool.h"
+
+#include <future>
+#include <chrono>
+#include <memory>
+#include <type_traits>
+
+using namespace std;
+
 /**
  * @file collector.h
  * @brief 시스템 모니터링을 위한 기본 수집기 클래스 정의
@@ -50,4 +61,108 @@ public:
      * 하위 클래스에서 할당한 자원을 정리하는 로직을 구현할 수 있도록 합니다.
      */
     virtual ~Collector() = default;
+
+    /**
+     * @brief 하위 작업 실행에 사용할 공유 작업자 풀을 설정합니다.
+     *
+     * 설정하지 않으면(nullptr) 하위 작업은 호출한 스레드에서 즉시 실행됩니다.
+     *
+     * @param pool 공유 작업자 풀 (소유권은 호출자에게 있음)
+     */
+    void setWorkerPool(WorkerPool *pool) { workerPool_ = pool; }
+
+    /**
+     * @brief 하위 작업의 CPU 시간을 기록할 자체 계측 슬롯을 설정합니다.
+     *
+     * @param slot SelfMetrics::registerCollector()가 반환한 슬롯 번호 (음수이면 기록하지 않음)
+     */
+    void setMetricsSlot(int slot) { metricsSlot_ = slot; }
+
+protected:
+    /**
+     * @brief 하위 작업 실행에 사용할 공유 작업자 풀 (nullptr이면 동기 실행)
+     */
+    WorkerPool *workerPool_ = nullptr;
+
+    /**
+     * @brief 하위 작업의 CPU 시간을 기록할 자체 계측 슬롯 (-1이면 기록하지 않음)
+     */
+    int metricsSlot_ = -1;
+
+    /**
+     * @brief 하위 작업을 공유 작업자 풀에 제출합니다.
+     *
+     * 작업자 풀이 없으면 작업을 즉시 실행하고 완료된 future를 반환합니다.
+     * 풀에서 실행되는 작업의 CPU 시간은 실행한 스레드에서 측정해 이 수집기의 cpu_ms에 더합니다.
+     *
+     * @tparam F 호출 가능한 작업 타입
+     * @param task 실행할 작업
+     * @return future 작업 결과를 받을 future 객체
+     */
+    template <typename F>
+    auto submitSubTask(F &&task) -> future<invoke_result_t<decay_t<F>>>
+    {
+        if (workerPool_)
+        {
+            return workerPool_->submit([task = forward<F>(task), slot = metricsSlot_]() mutable
+                                       {
+                                           SelfMetrics::SubTaskTimer timer(slot);
+                                           return task(); });
+        }
+
+        packaged_task<invoke_result_t<decay_t<F>>()> packaged(forward<F>(task));
+        auto result = packaged.get_future();
+        packaged();
+        return result;
+    }
+
+    /**
+     * @brief 끝나지 않을 수 있는 시스템 호출을 공유 BlockingPool에서 실행합니다.
+     *
+     * 작업자 풀 설정과 관계없이 별도 스레드에서 실행되므로, 호출이 멈춰도 작업자나
+     * 수집 스레드를 붙잡지 않습니다. 결과는 awaitSubTaskFor()로 제한 시간을 두고 기다립니다.
+     *
+     * @tparam F 호출 가능한 작업 타입
+     * @param task 실행할 작업 (시간 초과 후에도 안전하도록 공유 데이터만 캡처해야 함)
+     * @return future 작업 결과를 받을 future 객체
+     */
+    template <typename F>
+    auto submitBlockingTask(F &&task) -> future<invoke_result_t<decay_t<F>>>
+    {
+        return BlockingPool::shared().submit([task = forward<F>(task), slot = metricsSlot_]() mutable
+                                             {
+                                                 SelfMetrics::SubTaskTimer timer(slot);
+                                                 return task(); });
+    }
+
+    /**
+     * @brief 하위 작업이 완료될 때까지 대기하고 결과를 반환합니다.
+     *
+     * @param result submitSubTask()가 반환한 future 객체
+     * @return T 작업 결과
+     */
+    template <typename T>
+    T awaitSubTask(future<T> &result)
+    {
+        return workerPool_ ? workerPool_->wait(result) : result.get();
+    }
+
+    /**
+     * @brief 지정한 시간 동안 하위 작업의 완료를 대기합니다.
+     *
+     * 제한 시간을 지키기 위해 대기 중에 다른 작업을 대신 실행하지 않습니다.
+     *
+     * @param result submitSubTask() 또는 submitBlockingTask()가 반환한 future 객체
+     * @param timeout 최대 대기 시간
+     * @return bool 시간 내에 완료되었으면 true
+     */
+    template <typename T>
+    bool awaitSubTaskFor(future<T> &result, chrono::milliseconds timeout)
+    {
+        if (workerPool_)
+        {
+            return workerPool_->waitFor(result, timeout) == future_status::ready;
+        }
+        return result.wait_for(timeout) == future_status::ready;
+    }
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "collectors/cpu_collector.h"
 #include "collectors/memory_collector.h"
+#include "collectors/pressure_collector.h"
 #include "collectors/disk_collector.h"
 #include "collectors/network_collector.h"
 #include "collectors/process_collector.h"
@@ -9,7 +10,10 @@
 #include "collectors/docker_collector.h"
 #include "collectors/service_collector.h"
 #include "models/system_metrics.h"
-#include "common/thread_safe_queue.h"
+#include "common/queue_factory.h"
+#include "common/timer_wheel.h"
+#include "common/worker_pool.h"
+#include "config/collector_options.h"
 
 #include <thread>
 #include <vector>
@@ -19,6 +23,8 @@
 #include <future>
 #include <mutex>
 #include <condition_variable>
+#include <memory>
+#include <set>
 
 using namespace std;
 
@@ -26,8 +32,13 @@ using namespace std;
  * @brief 시스템 모니터링을 위한 데이터 수집기 관리 클래스
  *
  * 여러 종류의 시스템 데이터 수집기를 관리하고 주기적으로 데이터를 수집하는
- * 매니저 클래스입니다. 병렬 처리를 통해 효율적으로 여러 시스템 메트릭을
- * 동시에 수집합니다.
+ * 매니저 클래스입니다. 수집기는 타입이 소거된 레지스트리에 등록되며
+ * 옵션으로 활성화하거나 비활성화할 수 있습니다. 각 수집기는 자신의 수집 주기와 허용 시간을 가지며
+ * 타이머 휠 스케줄러에 의해 공유 작업자 풀에서 독립적으로 실행됩니다. 스냅샷은 발행 주기마다
+ * 각 수집기의 최신 결과를 모아 생성되므로 느린 수집기가 다른 수집기를
+ * 지연시키지 않습니다. 틱과 발행 시점은 벽시계 경계에 정렬된 절대 시각으로 예약되므로
+ * 주기가 밀리지 않고, 여러 호스트의 샘플이 같은 초에 맞춰집니다.
+ * 수집기별 주기는 결과의 변화량에 따라 늘거나 줄고, 에이전트 CPU 예산을 넘으면 전체적으로 늘어납니다.
  */
 class CollectorManager
 {
@@ -36,9 +47,10 @@ public:
      * @brief CollectorManager 생성자
      *
      * @param systemKey 시스템 식별을 위한 고유 키 값
+     * @param options 수집기별 주기 등 실행 옵션
      * @param queueSize 수집된 데이터를 저장할 큐의 최대 크기 (기본값: 50)
      */
-    CollectorManager(const string &systemKey, size_t queueSize = 50);
+    CollectorManager(const string &systemKey, const CollectorOptions &options = CollectorOptions(), size_t queueSize = 50);
 
     /**
      * @brief CollectorManager 소멸자
@@ -50,7 +62,7 @@ public:
     /**
      * @brief 시스템 데이터 수집 작업 시작
      *
-     * @param intervalSeconds 데이터 수집 주기(초 단위, 기본값: 5)
+     * @param intervalSeconds 스냅샷 발행 주기이자 수집기 기본 수집 주기(초 단위, 기본값: 5)
      */
     void start(int intervalSeconds = 5);
 
@@ -64,104 +76,370 @@ public:
     /**
      * @brief 수집된 데이터 큐에 대한 접근자
      *
-     * @return ThreadSafeQueue<SystemMetrics>& 수집된 시스템 메트릭 데이터가 저장된 쓰레드 안전 큐
+     * @return BoundedQueue<SystemMetrics>& 수집된 시스템 메트릭 데이터가 저장된 쓰레드 안전 큐
      */
-    ThreadSafeQueue<SystemMetrics> &getDataQueue() { return dataQueue_; }
+    BoundedQueue<SystemMetrics> &getDataQueue() { return *dataQueue_; }
+
+    /**
+     * @brief 전송을 마친 스냅샷을 돌려받는 재사용 큐에 대한 접근자
+     *
+     * 소비자가 사용을 마친 SystemMetrics를 이 큐에 넣으면 다음 스냅샷 생성 시
+     * 해당 객체의 벡터와 문자열 버퍼를 재사용합니다.
+     *
+     * @return BoundedQueue<SystemMetrics>& 스냅샷 재사용 큐
+     */
+    BoundedQueue<SystemMetrics> &getRecycleQueue() { return *recycleQueue_; }
 
 private:
     /**
-     * @brief CPU 사용량 수집기 인스턴스
+     * @brief 수집 작업과 수집기 하위 작업이 공유하는 작업자 풀
+     *
+     * 수집기보다 먼저 생성되고 나중에 소멸되도록 첫 번째 멤버로 선언합니다.
      */
-    CPUCollector cpuCollector_;
+    WorkerPool workerPool_;
 
     /**
-     * @brief 메모리 사용량 수집기 인스턴스
+     * @brief 시스템 식별 키
      */
-    MemoryCollector memoryCollector_;
+    string systemKey_;
 
     /**
-     * @brief 디스크 사용량 수집기 인스턴스
+     * @brief 수집된 데이터를 저장하는 쓰레드 안전 큐 (CollectorOptions::queue에 따라 구현 선택)
+     *
+     * 생산자는 수집 루프 스레드, 소비자는 데이터 전송 스레드 하나뿐이므로 SPSC 링 버퍼도 사용할 수 있습니다.
      */
-    DiskCollector diskCollector_;
+    unique_ptr<BoundedQueue<SystemMetrics>> dataQueue_;
 
     /**
-     * @brief 네트워크 트래픽 수집기 인스턴스
+     * @brief 소비자가 돌려준 스냅샷을 보관하는 재사용 큐 (dataQueue_와 같은 구현)
      */
-    NetworkCollector networkCollector_;
+    unique_ptr<BoundedQueue<SystemMetrics>> recycleQueue_;
 
     /**
-     * @brief 프로세스 정보 수집기 인스턴스
+     * @brief 주 수집 작업 쓰레드
      */
-    ProcessCollector processCollector_;
+    thread collectionThread_;
 
     /**
-     * @brief 시스템 기본 정보 수집기 인스턴스
+     * @brief 수집기 실행 옵션
      */
-    SystemInfoCollector systemInfoCollector_;
+    CollectorOptions options_;
 
     /**
-     * @brief 도커 컨테이너 정보 수집기 인스턴스
+     * @brief 수집 결과를 직전 결과와 비교한 변화 정도
      */
-    DockerCollector dockerCollector_;
+    enum class ChangeKind
+    {
+        Unchanged, ///< 직전 결과와 같음 (주기를 점차 늘림)
+        Changed,   ///< 값이 바뀜 (기본 주기 유지)
+        Burst      ///< 값이 급변함 (주기를 앞당김)
+    };
 
     /**
-     * @brief 서비스 상태 수집기 인스턴스
+     * @brief 변화 판정 함수를 지정하지 않은 수집기의 기본 판정 (항상 기본 주기 유지)
      */
-    ServiceCollector serviceCollector_;
+    struct AlwaysChanged
+    {
+        template <typename Field>
+        ChangeKind operator()(const Field &, const Field &) const { return ChangeKind::Changed; }
+    };
 
     /**
-     * @brief 시스템 식별 키
+     * @brief 레지스트리에 등록된 개별 수집기의 실행 일정과 결과 슬롯 정보
+     *
+     * 수집기 인스턴스는 task 안에 타입이 소거된 채로 보관됩니다.
      */
-    string systemKey_;
+    struct CollectorSchedule
+    {
+        string name;                                  ///< 수집기 이름
+        string section;                               ///< 스냅샷에서 담당하는 섹션 이름
+        chrono::milliseconds period;                  ///< 기본 수집 주기
+        chrono::milliseconds adaptivePeriod;          ///< 변화량에 따라 조정된 수집 주기 (CPU 예산 배율 적용 전)
+        ChangeKind lastChange = ChangeKind::Changed;  ///< 마지막 수집 결과의 변화 정도 (sectionMutex로 보호)
+        chrono::milliseconds deadline;                ///< 1회 수집 허용 시간
+        function<void()> task;                        ///< 수집 후 자신의 섹션 슬롯에 결과를 기록하는 작업
+        function<void(SystemMetrics &)> copySection;  ///< 섹션 슬롯을 스냅샷으로 복사하는 함수 (sectionMutex 보유 상태에서 호출)
+        mutex sectionMutex;                           ///< 섹션 슬롯과 완료 정보를 보호하는 수집기별 뮤텍스
+        future<void> inFlight;                        ///< 실행 중인 수집 작업
+        chrono::steady_clock::time_point startedAt;   ///< 마지막 실행 시작 시각
+        bool overrunReported = false;                 ///< 허용 시간 초과 경고 출력 여부
+        chrono::steady_clock::time_point completedAt; ///< 마지막 완료 시각 (sectionMutex로 보호)
+        bool hasCompleted = false;                    ///< 한 번이라도 완료했는지 여부 (sectionMutex로 보호)
+        int metricsSlot = -1;                         ///< 자체 계측 레지스트리 슬롯 번호
+    };
 
     /**
-     * @brief 수집된 데이터를 저장하는 쓰레드 안전 큐
+     * @brief 등록된 수집기 목록 (뮤텍스를 포함하므로 포인터로 보관)
      */
-    ThreadSafeQueue<SystemMetrics> dataQueue_;
+    vector<unique_ptr<CollectorSchedule>> schedules_;
 
     /**
-     * @brief 주 수집 작업 쓰레드
+     * @brief 활성화 여부와 관계없이 알려진 수집기 이름 목록 (옵션 검증용)
      */
-    thread collectionThread_;
+    set<string> knownCollectors_;
+
+    /**
+     * @brief 수집기 일정을 관리하는 타이머 휠 (schedules_ 인덱스 저장)
+     */
+    TimerWheel<size_t> timerWheel_;
+
+    /**
+     * @brief 수집기 하나의 섹션을 담는 이중 버퍼
+     *
+     * 수집 작업은 잠금 없이 뒤쪽 버퍼를 채운 뒤 sectionMutex 아래에서 front만 바꾸고,
+     * 스냅샷은 앞쪽 버퍼를 복사합니다. 두 버퍼는 주기마다 번갈아 재사용되므로
+     * 정상 상태에서는 벡터와 문자열 용량이 유지되어 새 할당이 거의 발생하지 않습니다.
+     *
+     * @tparam Field 섹션 필드 타입
+     */
+    template <typename Field>
+    struct SectionBuffer
+    {
+        Field slots[2]{};    ///< 앞쪽/뒤쪽 버퍼
+        size_t front = 0;    ///< 스냅샷이 읽는 버퍼 번호 (sectionMutex로 보호)
+        bool filled = false; ///< 앞쪽 버퍼에 수집 결과가 한 번이라도 기록됐는지 여부 (수집 작업 전용)
+    };
+
+    /**
+     * @brief 프로세스 수집기의 결과 버퍼 (프로세스 목록과 트리/cgroup 합산 정보를 함께 교체)
+     */
+    struct ProcessSection
+    {
+        vector<ProcessInfo> processes;         ///< 프로세스 목록
+        vector<ProcessGroupInfo> trees;        ///< 프로세스 트리별 합산 정보
+        vector<ProcessGroupInfo> cgroups;      ///< cgroup별 합산 정보
+    };
+
+    /**
+     * @brief 아직 발행되지 않은 프로세스 생명주기 이벤트
+     *
+     * 이벤트는 상태가 아닌 발생 기록이므로 섹션 이중 버퍼를 거치지 않고, 수집마다 뒤에 이어 붙였다가
+     * 스냅샷 발행 시 한 번만 옮겨 담습니다. 따라서 발행보다 수집이 잦거나 드물어도 중복되거나 빠지지 않습니다.
+     */
+    vector<ProcessEventInfo> pendingEvents_;
+
+    /**
+     * @brief pendingEvents_ 접근 동기화를 위한 뮤텍스
+     */
+    mutex eventsMutex_;
+
+    /**
+     * @brief 시스템 키로부터 정해지는 호스트별 고정 지터 (벽시계 경계로부터의 오프셋)
+     */
+    chrono::milliseconds jitter_{0};
+
+    /**
+     * @brief CPU 예산 초과로 모든 수집 주기에 곱해지는 배율 (수집 루프 스레드 전용)
+     */
+    double rateScale_ = 1.0;
+
+    /**
+     * @brief 직전 예산 확인 시점의 프로세스 CPU 시간
+     */
+    chrono::nanoseconds lastCpuTime_{0};
+
+    /**
+     * @brief 직전 예산 확인 시각
+     */
+    chrono::steady_clock::time_point lastBudgetCheck_;
+
+    /**
+     * @brief 결과가 바뀌지 않을 때 늘어나는 주기의 기본 주기 대비 최대 배수
+     */
+    static constexpr int MAX_BACKOFF_FACTOR = 8;
+
+    /**
+     * @brief 값이 급변했을 때 앞당긴 주기의 하한
+     */
+    static constexpr chrono::milliseconds MIN_BURST_PERIOD{1000};
+
+    /**
+     * @brief CPU 예산 초과 시 주기 배율의 상한
+     */
+    static constexpr double MAX_RATE_SCALE = 8.0;
+
+    /**
+     * @brief 급변으로 판단하는 CPU 사용률 변화량 (%p)
+     */
+    static constexpr float CPU_BURST_THRESHOLD = 20.0f;
+
+    /**
+     * @brief 급변으로 판단하는 메모리 사용률 변화량 (%p)
+     */
+    static constexpr float MEMORY_BURST_THRESHOLD = 10.0f;
+
+    /**
+     * @brief 변화로 판단하는 디스크 사용률 변화량 (%p)
+     */
+    static constexpr float DISK_CHANGE_THRESHOLD = 1.0f;
+
+    /**
+     * @brief 변화로 판단하는 컨테이너, 서비스의 CPU/메모리 사용률 변화량 (%p)
+     */
+    static constexpr float LOAD_CHANGE_THRESHOLD = 5.0f;
+
+    /**
+     * @brief 도커 데몬 소켓 경로 (없으면 docker 수집기를 건너뜀)
+     */
+    static constexpr const char *DOCKER_SOCKET_PATH = "/var/run/docker.sock";
 
     /**
-     * @brief 개별 수집기 작업 상태를 관리하는 future 객체 목록
+     * @brief systemd 부팅 여부 확인 경로 (없으면 service 수집기를 건너뜀)
      */
-    vector<future<void>> collectorTasks_;
+    static constexpr const char *SYSTEMD_RUNTIME_PATH = "/run/systemd/system";
 
     /**
-     * @brief 쓰레드 풀 (future 객체 정리용)
+     * @brief PSI 디렉토리 경로 (이 경로와 SCHEDSTAT_PATH가 모두 없으면 pressure 수집기를 건너뜀)
      */
-    vector<future<void>> threadPool_;
+    static constexpr const char *PRESSURE_PATH = "/proc/pressure";
+
+    /**
+     * @brief 스케줄러 통계 파일 경로
+     */
+    static constexpr const char *SCHEDSTAT_PATH = "/proc/schedstat";
+
+    /**
+     * @brief 스케줄러 틱 간격
+     */
+    static constexpr chrono::milliseconds TICK_INTERVAL{100};
 
     /**
      * @brief 주기적인 데이터 수집 루프 실행 함수
      *
-     * @param intervalSeconds 수집 주기(초 단위)
+     * @param intervalSeconds 스냅샷 발행 주기(초 단위)
      */
     void collectLoop(int intervalSeconds);
 
     /**
-     * @brief 병렬로 여러 수집기의 데이터를 동시에 수집하는 함수
+     * @brief 수집기를 레지스트리에 등록하는 템플릿 함수
+     *
+     * @tparam CollectorType 수집기 타입
+     * @tparam Field 수집기가 담당하는 SystemMetrics 필드 타입
+     * @tparam Fill 수집기 인스턴스의 결과를 기존 필드 버퍼에 채우는 함수 타입
+     * @param name 수집기 이름
+     * @param section 스냅샷에서 담당하는 섹션 이름
+     * @param period 기본 수집 주기
+     * @param field 수집 결과를 기록할 SystemMetrics 멤버
+     * @param fill 수집기 인스턴스의 결과를 버퍼에 채우는 함수
+     * @param change 직전 결과와 새 결과를 비교해 ChangeKind를 반환하는 함수 (기본값: 항상 Changed)
+     */
+    template <typename CollectorType, typename Field, typename Fill, typename Change = AlwaysChanged>
+    void addCollector(const string &name, const string &section, chrono::milliseconds period,
+                      Field SystemMetrics::*field, Fill fill, Change change = Change());
+
+    /**
+     * @brief 결과를 스냅샷의 여러 멤버에 나눠 기록하는 수집기를 등록하는 템플릿 함수
+     *
+     * @tparam CollectorType 수집기 타입
+     * @tparam Field 수집기 결과 버퍼 타입 (명시적으로 지정)
+     * @tparam Store 결과 버퍼를 스냅샷에 복사하는 함수 타입 (void(SystemMetrics &, const Field &))
+     * @tparam Fill 수집기 인스턴스의 결과를 기존 필드 버퍼에 채우는 함수 타입
+     * @param name 수집기 이름
+     * @param section 스냅샷에서 담당하는 섹션 이름
+     * @param period 기본 수집 주기
+     * @param store 결과 버퍼를 스냅샷에 복사하는 함수 (sectionMutex 보유 상태에서 호출)
+     * @param fill 수집기 인스턴스의 결과를 버퍼에 채우는 함수
+     * @param change 직전 결과와 새 결과를 비교해 ChangeKind를 반환하는 함수 (기본값: 항상 Changed)
+     */
+    template <typename CollectorType, typename Field, typename Store, typename Fill, typename Change = AlwaysChanged>
+    void addCollector(const string &name, const string &section, chrono::milliseconds period,
+                      Store store, Fill fill, Change change = Change());
+
+    /**
+     * @brief 수집기 활성화 여부를 확인하는 함수
+     *
+     * @param name 수집기 이름
+     * @return bool 실행해야 하면 true
+     */
+    bool isCollectorEnabled(const string &name) const;
+
+    /**
+     * @brief 주기가 도래한 수집기를 실행하는 함수
+     *
+     * 이전 실행이 아직 끝나지 않았다면 이번 주기는 건너뜁니다.
+     *
+     * @param index 수집기 일정 인덱스
+     */
+    void dispatchCollector(size_t index);
+
+    /**
+     * @brief 마지막 수집 결과의 변화 정도와 CPU 예산 배율로 다음 수집 주기를 계산
+     *
+     * @param schedule 수집기 일정
+     * @return chrono::milliseconds 다음 실행까지의 주기
+     */
+    chrono::milliseconds adaptPeriod(CollectorSchedule &schedule);
+
+    /**
+     * @brief 직전 확인 이후의 에이전트 CPU 사용률로 주기 배율을 갱신
+     */
+    void updateRateScale();
+
+    /**
+     * @brief 허용 시간을 초과해 실행 중인 수집기를 확인하는 함수
+     */
+    void checkDeadlines();
+
+    /**
+     * @brief 프로세스 수집기가 이번 수집에서 받은 이벤트를 발행 대기 목록에 추가
+     *
+     * @param events 추가할 이벤트
+     */
+    void appendProcessEvents(const vector<ProcessEventInfo> &events);
+
+    /**
+     * @brief 최신 수집 결과로 스냅샷을 만들어 큐에 추가하는 함수
+     *
+     * @param cycleStart 발행 주기가 도래한 시각
+     * @param cycleTime 발행 주기의 벽시계 경계 시각 (스냅샷 타임스탬프로 사용)
+     */
+    void publishSnapshot(chrono::steady_clock::time_point cycleStart, chrono::system_clock::time_point cycleTime);
+
+    /**
+     * @brief 현재 시각 이후 가장 가까운 벽시계 주기 경계를 계산
+     *
+     * @param period 주기
+     * @return chrono::system_clock::time_point 에포크 기준 period 배수 + 지터 시각
+     */
+    chrono::system_clock::time_point nextBoundary(chrono::milliseconds period) const;
+
+    /**
+     * @brief 벽시계 시각을 같은 순간의 steady_clock 시각으로 변환
+     *
+     * @param wallTime 변환할 벽시계 시각
+     * @return chrono::steady_clock::time_point 대응하는 steady_clock 시각
+     */
+    static chrono::steady_clock::time_point toSteady(chrono::system_clock::time_point wallTime);
+
+    /**
+     * @brief 발행 시점 이전에 시작된 수집이 모두 끝났는지 확인
+     *
+     * @param cycleStart 발행 주기가 도래한 시각
+     * @return bool 기다릴 수집이 없으면 true
+     */
+    bool cycleCompleted(chrono::steady_clock::time_point cycleStart) const;
+
+    /**
+     * @brief 발행 주기마다 수집 완료를 기다리는 최대 시간 계산
+     *
+     * @param publishInterval 스냅샷 발행 주기
+     * @return chrono::milliseconds 주기별 대기 허용 시간
      */
-    void collectDataParallel();
+    chrono::milliseconds cycleDeadline(chrono::milliseconds publishInterval) const;
 
     /**
-     * @brief 현재 시간 정보를 문자열로 생성하는 함수
+     * @brief 주기를 타이머 휠 틱 수로 변환하는 함수
      *
-     * @return string 현재 시간 문자열
+     * @param period 변환할 주기
+     * @return uint64_t 틱 수
      */
-    string getCurrentTime();
+    static uint64_t toTicks(chrono::milliseconds period);
 
     /**
-     * @brief 단일 수집기의 작업을 생성하는 템플릿 함수
+     * @brief 시각을 타임스탬프 문자열로 생성하는 함수
      *
-     * @tparam Collector 수집기 타입
-     * @param collector 수집기 인스턴스 참조
-     * @param metrics 수집된 데이터를 저장할 메트릭 객체
-     * @param metricsMutex 메트릭 객체 접근을 동기화할 뮤텍스
-     * @return function<void()> 수집 작업 함수 객체
+     * @param time 변환할 시각
+     * @return string 시간 문자열
      */
-    template <typename Collector>
-    function<void()> createCollectorTask(Collector &collector, SystemMetrics &metrics, mutex &metricsMutex);
+    static string formatTimestamp(chrono::system_clock::time_point time);
 };
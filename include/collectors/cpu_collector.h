@@ -6,20 +6,62 @@
 #pragma once
 #include "collector.h"
 #include "models/cpu_info.h"
+#include <cstdint>
 #include <vector>
 
 using namespace std;
 
 /**
- * @struct stJiffies
- * @brief CPU 사용량 계산을 위한 Jiffies 정보 구조체
+ * @struct JiffyTable
+ * @brief /proc/stat의 CPU 시간 열을 열 단위로 저장하는 표 (struct-of-arrays)
+ *
+ * 행 0은 전체 CPU, 행 i + 1은 i번째 코어이며, 열 c의 행 r 값은 values[c * rows + r]에 있습니다.
+ * 열마다 연속된 배열이므로 코어 수가 많아도 주기 간 차이 계산이 행 방향으로 벡터화됩니다.
  */
-struct stJiffies
+struct JiffyTable
 {
-    long int user = 0;   ///< 사용자 프로세스 실행 시간
-    long int nice = 0;   ///< 낮은 우선순위 사용자 프로세스 실행 시간
-    long int system = 0; ///< 시스템(커널) 프로세스 실행 시간
-    long int idle = 0;   ///< 유휴 시간
+    /**
+     * @brief /proc/stat cpu 줄의 열 순서
+     */
+    enum Column : size_t
+    {
+        User,
+        Nice,
+        System,
+        Idle,
+        Iowait,
+        Irq,
+        Softirq,
+        Steal,
+        Guest,
+        GuestNice,
+        COLUMNS
+    };
+
+    size_t rows = 0;         ///< 행 수 (코어 수 + 1)
+    vector<uint64_t> values; ///< 열 우선으로 저장한 누적 jiffies
+    vector<size_t> ids;      ///< 행별 CPU 번호 (cpuN의 N, 행 0은 사용하지 않음)
+
+    /**
+     * @brief 행 수를 바꾸고 모든 값을 0으로 초기화
+     *
+     * @param rowCount 새 행 수
+     */
+    void resize(size_t rowCount)
+    {
+        rows = rowCount;
+        values.assign(COLUMNS * rowCount, 0);
+        ids.assign(rowCount, 0);
+    }
+
+    /**
+     * @brief 열 하나의 시작 위치 반환
+     *
+     * @param c 열 번호
+     * @return uint64_t* rows개의 연속된 값
+     */
+    uint64_t *column(size_t c) { return values.data() + c * rows; }
+    const uint64_t *column(size_t c) const { return values.data() + c * rows; }
 };
 
 /**
@@ -31,9 +73,11 @@ class CPUCollector : public Collector
 {
 private:
     CpuInfo cpuInfo;                   ///< 수집된 CPU 정보를 저장하는 객체
-    vector<stJiffies> prevCoreJiffies; ///< 각 코어의 이전 지표
-    struct stJiffies curJiffies;       ///< 현재 CPU 전체 Jiffies 정보
-    struct stJiffies prevJiffies;      ///< 이전 CPU 전체 Jiffies 정보
+    JiffyTable curJiffies;             ///< 이번 주기의 전체/코어별 jiffies
+    JiffyTable prevJiffies;            ///< 이전 주기의 전체/코어별 jiffies
+    vector<uint64_t> jiffyDelta;       ///< 열 우선 주기 간 jiffies 차이 (주기 간 용량 재사용)
+    vector<float> jiffyScale;          ///< 행별 백분율 환산 계수 (100 / 전체 차이)
+    vector<int> curFreqFds;            ///< CPU 번호별 cpufreq scaling_cur_freq fd (-1이면 없음, -2이면 아직 열지 않음)
     unsigned long last_temp_read_time; ///< 온도 캐싱을 위한 시간 변수
 
     /**
@@ -47,10 +91,20 @@ private:
     void collectCacheInfo();
 
     /**
-     * @brief 기본 속도 정보를 위해 lscpu 사용
+     * @brief sysfs cpufreq에서 최소/최대/기본 클럭 속도 수집
      */
     void getBaseCpuSpeed();
 
+    /**
+     * @brief 코어별 현재 클럭 속도를 열어 둔 cpufreq fd에서 읽음
+     */
+    void sampleCoreSpeeds();
+
+    /**
+     * @brief 이전/현재 jiffies 표의 차이로 전체 및 코어별 사용률과 시간 항목별 비율을 계산
+     */
+    void computeUsage();
+
 public:
     /**
      * @brief CPU 정보를 수집하는 메서드
@@ -69,9 +123,12 @@ public:
      */
     virtual ~CPUCollector();
 
+    CPUCollector(const CPUCollector &) = delete;
+    CPUCollector &operator=(const CPUCollector &) = delete;
+
     /**
      * @brief 수집된 CPU 정보를 반환하는 메서드
-     * @return CPU 정보 구조체 (CpuInfo)
+     * @return CPU 정보 구조체 (CpuInfo)의 상수 참조
      */
-    const CpuInfo getCpuInfo() const;
+    const CpuInfo &getCpuInfo() const;
 };
\ No newline at end of file
@@ -7,13 +7,7 @@
 #include <string>
 #include <unordered_map>
 #include <chrono>
-#include <thread>
-#include <atomic>
 #include <mutex>
-#include <condition_variable>
-#include <queue>
-#include <functional>
-#include <future>
 
 using namespace std;
 
@@ -22,7 +16,7 @@ using namespace std;
  * @brief 디스크 정보를 수집하고 관리하는 클래스
  *
  * 시스템의 디스크 사용량, I/O 통계 등을 수집하고 분석하는 기능을 제공합니다.
- * 멀티스레드 방식으로 디스크 정보를 효율적으로 수집합니다.
+ * 마운트 지점별 사용량 조회는 공유 작업자 풀의 하위 작업으로 병렬 수행합니다.
  * @see Collector
  */
 class DiskCollector : public Collector
@@ -48,42 +42,6 @@ private:
      */
     mutable mutex disk_stats_mutex;
 
-    // 스레드 풀 관련 멤버 변수
-    /**
-     * @brief 스레드 풀의 크기
-     */
-    const size_t THREAD_POOL_SIZE = 4;
-
-    /**
-     * @brief 작업을 수행할 스레드 풀
-     */
-    vector<thread> thread_pool;
-
-    /**
-     * @brief 수행할 작업들을 저장하는 큐
-     */
-    queue<function<void()>> task_queue;
-
-    /**
-     * @brief 작업 큐 접근을 동기화하기 위한 뮤텍스
-     */
-    mutex queue_mutex;
-
-    /**
-     * @brief 작업 큐의 상태 변화를 알리는 조건 변수
-     */
-    condition_variable cv;
-
-    /**
-     * @brief 스레드 종료 신호를 위한 플래그
-     */
-    atomic<bool> stop_threads{false};
-
-    /**
-     * @brief 현재 활성화된 작업 수
-     */
-    atomic<int> active_tasks{0};
-
     /**
      * @brief 디스크 정보를 수집하는 메서드
      *
@@ -128,31 +86,6 @@ private:
      */
     string getParentDisk(const string &partition);
 
-    // 스레드 풀 관련 메서드
-    /**
-     * @brief 스레드 작업자 함수
-     *
-     * 스레드 풀의 각 스레드가 실행하는 메인 함수로, 작업 큐에서 작업을 가져와 실행합니다.
-     */
-    void threadWorker();
-
-    /**
-     * @brief 작업을 스레드 풀 큐에 추가하는 메서드
-     *
-     * @param task 실행할 함수 객체
-     */
-    void addTask(function<void()> task);
-
-    /**
-     * @brief 모든 작업이 완료될 때까지 대기하는 메서드
-     */
-    void waitForTasks();
-
-    /**
-     * @brief 대기 중인 비동기 작업들을 저장하는 벡터
-     */
-    vector<future<void>> pending_tasks;
-
     /**
      * @brief 작업 타임아웃 설정 (밀리초)
      */
@@ -162,14 +95,14 @@ public:
     /**
      * @brief 기본 생성자
      *
-     * 스레드 풀을 초기화하고 디스크 수집기를 설정합니다.
+     * 디스크 수집기를 설정하고 초기 디스크 정보를 수집합니다.
      */
     DiskCollector();
 
     /**
      * @brief 가상 소멸자
      *
-     * 스레드 풀을 정리하고 리소스를 해제합니다.
+     * 수집된 디스크 정보를 정리합니다.
      */
     virtual ~DiskCollector();
 
@@ -184,9 +117,9 @@ public:
     /**
      * @brief 수집된 디스크 통계 정보를 반환하는 메서드
      *
-     * @return vector<DiskInfo> 현재 수집된 모든 디스크 정보
+     * @return const vector<DiskInfo>& 현재 수집된 모든 디스크 정보의 상수 참조
      */
-    vector<DiskInfo> getDiskStats() const;
+    const vector<DiskInfo> &getDiskStats() const;
 
     /**
      * @brief 작업 타임아웃 시간을 설정하는 메서드
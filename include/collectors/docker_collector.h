@@ -127,6 +127,12 @@ public:
      */
     vector<DockerContainerInfo> getContainers() const;
 
+    /**
+     * @brief 수집된 컨테이너 정보를 기존 벡터에 채움
+     * @param out 결과를 채울 벡터 (기존 용량 재사용)
+     */
+    void getContainers(vector<DockerContainerInfo> &out) const;
+
     /**
      * @brief 캐시 유효 시간 설정 메서드
      * @param seconds 캐시 유효 시간 (초)
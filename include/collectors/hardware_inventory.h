@@ -0,0 +1,73 @@
+/**
+ * @file hardware_inventory.h
+ * @brief 실행 중 바뀌지 않는 하드웨어 구성 정보를 한 번만 읽어 보관하는 클래스 정의
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+using namespace std;
+
+/**
+ * @brief 메모리 모듈 구성 정보 (SMBIOS Type 17 기준)
+ */
+struct MemoryInventory
+{
+    uint64_t data_rate = 0;        ///< 장착된 모듈의 평균 속도 (MT/s, 알 수 없으면 0)
+    uint16_t total_slot_count = 0; ///< 총 슬롯 수
+    uint16_t using_slot_count = 0; ///< 모듈이 장착된 슬롯 수
+    string form_factor = "Etc";    ///< 첫 번째 슬롯의 메모리 형식 (알 수 없으면 "Etc")
+};
+
+/**
+ * @brief 하드웨어 인벤토리
+ *
+ * DIMM 속도, 슬롯 수, 폼 팩터처럼 실행 중 바뀌지 않는 정보를 /sys/firmware/dmi/tables/DMI의
+ * SMBIOS 구조체에서 직접 읽어 보관한다. 처음 조회할 때 한 번만 읽고, 이후에는 refresh()를
+ * 명시적으로 호출할 때만 다시 읽으므로 주기적인 수집 경로에서는 파일을 열지 않는다.
+ *
+ * DMI 테이블은 root만 읽을 수 있으므로 권한이 없으면 기본값(속도 0, 슬롯 0, "Etc")을 유지한다.
+ */
+class HardwareInventory
+{
+public:
+    /**
+     * @brief 전역 인벤토리 인스턴스 반환
+     *
+     * @return HardwareInventory& 인벤토리 인스턴스
+     */
+    static HardwareInventory &instance();
+
+    /**
+     * @brief 메모리 모듈 구성 정보 반환 (처음 호출 시 DMI 테이블을 읽음)
+     *
+     * @return MemoryInventory 메모리 모듈 구성 정보 사본
+     */
+    MemoryInventory memory();
+
+    /**
+     * @brief DMI 테이블을 다시 읽어 보관된 정보를 갱신
+     *
+     * @return bool DMI 테이블을 읽었으면 true
+     */
+    bool refresh();
+
+private:
+    HardwareInventory() = default;
+
+    /**
+     * @brief DMI 테이블에서 메모리 모듈 정보를 파싱
+     *
+     * @param path SMBIOS 구조체 테이블 경로
+     * @param out 파싱 결과 (실패 시 기본값)
+     * @return bool 테이블을 읽었으면 true
+     */
+    static bool parseMemory(const char *path, MemoryInventory &out);
+
+    mutex mutex_;            ///< 보관된 정보 보호
+    bool loaded_ = false;    ///< DMI 테이블 읽기를 시도했는지 여부
+    MemoryInventory memory_; ///< 메모리 모듈 구성 정보
+};
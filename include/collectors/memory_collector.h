@@ -8,6 +8,7 @@
 
 #pragma once
 #include "collector.h"
+#include "common/proc_file.h"
 #include "models/memory_info.h"
 
 /**
@@ -28,6 +29,11 @@ private:
      */
     MemoryInfo memoryInfo;
 
+    /**
+     * @brief 주기마다 다시 읽는 /proc/meminfo 리더 (fd와 버퍼 재사용)
+     */
+    ProcFile meminfo{"/proc/meminfo"};
+
     /**
      * @brief 메모리 정보를 초기화하는 내부 메서드
      *
@@ -49,7 +55,7 @@ public:
     /**
      * @brief 수집된 메모리 정보를 반환하는 메서드
      *
-     * @return MemoryInfo 수집된 메모리 정보 객체
+     * @return const MemoryInfo& 수집된 메모리 정보 객체의 상수 참조
      */
-    MemoryInfo getMemoryInfo() const;
+    const MemoryInfo &getMemoryInfo() const;
 };
\ No newline at end of file
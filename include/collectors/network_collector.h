@@ -119,4 +119,13 @@ public:
      * @return NetworkInterface 객체의 벡터
      */
     vector<NetworkInterface> getInterfacesToVector() const;
+
+    /**
+     * @brief 저장된 인터페이스 정보를 기존 벡터에 채움
+     *
+     * 기존 요소에 덮어써 벡터와 문자열의 용량을 재사용합니다.
+     *
+     * @param out 결과를 채울 벡터
+     */
+    void getInterfacesToVector(vector<NetworkInterface> &out) const;
 };
\ No newline at end of file
@@ -0,0 +1,84 @@
+/**
+ * @file pressure_collector.h
+ * @brief 자원 압력(PSI)과 CPU 실행 대기 시간을 수집하는 클래스 정의
+ */
+
+#pragma once
+#include "collector.h"
+#include "common/proc_file.h"
+#include "models/pressure_info.h"
+#include <chrono>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class PressureCollector
+ * @brief /proc/pressure와 /proc/schedstat에서 포화 지표를 수집하는 클래스
+ *
+ * PSI의 some/full 평균과 누적 시간을 읽고, 누적 시간과 코어별 실행 큐 대기 시간은
+ * 직전 수집과의 차이로 이번 주기의 값을 계산합니다. 파일은 처음 한 번 열어 둔 fd를 재사용합니다.
+ *
+ * @see Collector
+ * @see PressureInfo
+ */
+class PressureCollector : public Collector
+{
+private:
+    /**
+     * @brief 수집된 압력 정보
+     */
+    PressureInfo pressureInfo;
+
+    ProcFile cpuPressure{"/proc/pressure/cpu", 256};       ///< CPU PSI 리더
+    ProcFile memoryPressure{"/proc/pressure/memory", 256}; ///< 메모리 PSI 리더
+    ProcFile ioPressure{"/proc/pressure/io", 256};         ///< I/O PSI 리더
+    ProcFile schedstat{"/proc/schedstat"};                 ///< 스케줄러 통계 리더
+
+    /**
+     * @brief 직전 수집의 코어별 누적 값 (run_time, wait_time, timeslices 순)
+     */
+    vector<uint64_t> prevSched;
+
+    /**
+     * @brief 직전 수집 시각 (경과 시간 계산용)
+     */
+    chrono::steady_clock::time_point lastCollectTime;
+
+    /**
+     * @brief 직전 수집 결과가 있는지 여부
+     */
+    bool hasPrevious = false;
+
+    /**
+     * @brief PSI 파일 하나를 읽어 some/full 값과 차이를 갱신
+     *
+     * @param file PSI 파일 리더
+     * @param pressure 갱신할 압력 정보
+     * @param elapsedUs 직전 수집 이후 경과 시간 (마이크로초, 첫 수집이면 0)
+     * @return bool 파일을 읽었으면 true
+     */
+    bool readPressure(ProcFile &file, ResourcePressure &pressure, double elapsedUs);
+
+    /**
+     * @brief /proc/schedstat의 cpu 줄을 읽어 코어별 실행/대기 시간 차이를 갱신
+     *
+     * @param elapsedNs 직전 수집 이후 경과 시간 (나노초, 첫 수집이면 0)
+     */
+    void readSchedstat(double elapsedNs);
+
+public:
+    /**
+     * @brief 압력 정보를 수집하는 메서드
+     *
+     * PSI를 읽을 수 없으면 available을 false로 두고, schedstat이 없으면 코어 목록을 비웁니다.
+     */
+    void collect() override;
+
+    /**
+     * @brief 수집된 압력 정보를 반환하는 메서드
+     *
+     * @return const PressureInfo& 수집된 압력 정보의 상수 참조
+     */
+    const PressureInfo &getPressureInfo() const;
+};
@@ -0,0 +1,135 @@
+#pragma once
+/**
+ * @file proc_connector.h
+ * @brief netlink 프로세스 커넥터로 프로세스 생명주기 이벤트를 수신하는 리스너 정의
+ */
+#include "models/process_event_info.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <sys/types.h>
+
+using namespace std;
+
+/**
+ * @class ProcConnector
+ * @brief netlink 프로세스 커넥터(PROC_EVENT_FORK/EXEC/EXIT) 리스너
+ *
+ * 별도 스레드에서 커널이 보내는 프로세스 이벤트를 받아 크기가 제한된 링 버퍼에 기록하고,
+ * 새로 생긴 PID를 모아 ProcessCollector가 /proc 전체를 다시 읽지 않고도 새 프로세스를 알 수 있게 합니다.
+ * 커넥터 구독에는 CAP_NET_ADMIN이 필요하므로 start()가 실패하면 호출자는 주기적 폴링으로 동작해야 합니다.
+ * 스레드 생성/종료 이벤트는 무시하고 프로세스(스레드 그룹 리더) 이벤트만 기록합니다.
+ */
+class ProcConnector
+{
+public:
+    /**
+     * @brief 리스너 생성자
+     *
+     * @param capacity 보관할 최대 이벤트 수 (가득 차면 가장 오래된 이벤트를 덮어씀)
+     */
+    explicit ProcConnector(size_t capacity = 1024);
+
+    /**
+     * @brief 리스너 소멸자 - 수신 스레드를 멈추고 소켓을 닫음
+     */
+    ~ProcConnector();
+
+    ProcConnector(const ProcConnector &) = delete;
+    ProcConnector &operator=(const ProcConnector &) = delete;
+
+    /**
+     * @brief 커넥터를 구독하고 수신 스레드를 시작
+     *
+     * @return bool 구독에 성공했으면 true (권한이 없거나 커널이 지원하지 않으면 false)
+     */
+    bool start();
+
+    /**
+     * @brief 수신 스레드를 멈춤
+     */
+    void stop();
+
+    /**
+     * @brief 이벤트를 수신 중인지 확인
+     *
+     * @return bool 수신 스레드가 동작 중이면 true
+     */
+    bool active() const { return active_.load(memory_order_acquire); }
+
+    /**
+     * @brief 마지막 호출 이후 기록된 이벤트를 꺼냄
+     *
+     * @param events 결과를 채울 벡터 (기존 내용은 지워지고 오래된 순으로 채워짐)
+     */
+    void drainEvents(vector<ProcessEventInfo> &events);
+
+    /**
+     * @brief 마지막 호출 이후 새로 생긴 프로세스의 PID를 꺼냄
+     *
+     * @param pids 결과를 채울 벡터 (기존 내용은 지워짐)
+     * @return bool 이벤트를 빠짐없이 받았으면 true, 소켓 버퍼 초과 등으로 놓쳤을 수 있으면 false
+     */
+    bool drainNewPids(vector<pid_t> &pids);
+
+    /**
+     * @brief 링 버퍼가 가득 차 덮어쓴 누적 이벤트 수 반환
+     *
+     * @return uint64_t 덮어쓴 이벤트 수
+     */
+    uint64_t dropped() const { return dropped_.load(memory_order_relaxed); }
+
+private:
+    /**
+     * @brief 생성을 관측한 프로세스의 시작 정보
+     */
+    struct Started
+    {
+        uint64_t timestampNs = 0; ///< 생성 이벤트의 커널 타임스탬프 (부팅 후 나노초)
+        string name;              ///< exec 시점에 읽은 프로세스 이름
+    };
+
+    /**
+     * @brief 시작 정보를 보관할 최대 프로세스 수 (종료 이벤트를 놓친 항목이 쌓이는 것을 방지)
+     */
+    static constexpr size_t MAX_TRACKED = 65536;
+
+    int socket_;                         ///< netlink 소켓
+    thread thread_;                      ///< 수신 스레드
+    atomic<bool> stop_{false};           ///< 수신 스레드 중지 플래그
+    atomic<bool> active_{false};         ///< 수신 중 여부
+    atomic<uint64_t> dropped_{0};        ///< 덮어쓴 누적 이벤트 수
+
+    mutex mutex_;                        ///< 아래 링 버퍼와 새 PID 목록 보호
+    vector<ProcessEventInfo> ring_;      ///< 이벤트 링 버퍼
+    size_t head_ = 0;                    ///< 다음에 기록할 위치
+    size_t count_ = 0;                   ///< 꺼내지 않은 이벤트 수
+    vector<pid_t> newPids_;              ///< 마지막으로 꺼낸 이후 새로 생긴 PID
+    bool lost_ = false;                  ///< 마지막으로 꺼낸 이후 이벤트를 놓쳤을 수 있는지 여부
+
+    unordered_map<pid_t, Started> started_; ///< PID별 시작 정보 (수신 스레드 전용)
+
+    /**
+     * @brief 수신 스레드 본체
+     */
+    void run();
+
+    /**
+     * @brief 수신한 netlink 메시지 하나를 처리
+     *
+     * @param data 메시지 버퍼
+     * @param length 메시지 길이
+     */
+    void handleMessage(const char *data, size_t length);
+
+    /**
+     * @brief 이벤트를 링 버퍼에 기록
+     *
+     * @param event 기록할 이벤트
+     */
+    void record(ProcessEventInfo &&event);
+};
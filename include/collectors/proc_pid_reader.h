@@ -0,0 +1,204 @@
+#pragma once
+/**
+ * @file proc_pid_reader.h
+ * @brief /proc/[pid] 파일을 직접 읽어 파싱하는 프로세스 정보 리더 정의
+ */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+using namespace std;
+
+/**
+ * @brief /proc/[pid]에서 읽은 프로세스 하나의 원시 값
+ *
+ * ProcPidReader가 요청한 항목 그룹에 해당하는 필드만 채워지며,
+ * 같은 객체를 반복해서 넘기면 문자열 버퍼가 재사용됩니다.
+ */
+struct ProcPidSample
+{
+    pid_t pid = 0; ///< 프로세스 ID
+
+    // /proc/[pid]/stat
+    string comm;                      ///< 실행 파일 이름 (최대 15자)
+    char state = '?';                 ///< 상태 코드 (R, S, D, Z, T 등)
+    pid_t ppid = 0;                   ///< 부모 프로세스 ID
+    unsigned long long utime = 0;     ///< 사용자 모드 CPU 시간 (클럭 틱)
+    unsigned long long stime = 0;     ///< 커널 모드 CPU 시간 (클럭 틱)
+    long nice = 0;                    ///< nice 값
+    long numThreads = 0;              ///< 스레드 수
+    unsigned long long startTime = 0; ///< 부팅 후 프로세스 시작 시각 (클럭 틱)
+
+    // /proc/[pid]/statm
+    uint64_t vmSizeBytes = 0; ///< 가상 메모리 크기 (바이트)
+    uint64_t rssBytes = 0;    ///< 상주 메모리 크기 (바이트)
+
+    // /proc/[pid]/cmdline
+    string cmdline; ///< 공백으로 이어 붙인 명령행 (커널 스레드는 빈 문자열)
+
+    // /proc/[pid] 디렉토리 소유자
+    uid_t uid = 0; ///< 프로세스 소유 사용자 ID
+
+    // /proc/[pid]/io
+    uint64_t ioReadBytes = 0;  ///< 저장 장치에서 읽은 바이트 수 (read_bytes)
+    uint64_t ioWriteBytes = 0; ///< 저장 장치에 쓴 바이트 수 (write_bytes)
+
+    // /proc/[pid]/fd
+    int openFds = 0; ///< 열린 파일 디스크립터 수
+
+    // /proc/[pid]/cgroup
+    string cgroup; ///< cgroup 경로 (v1 cpu 컨트롤러 계층, 없으면 v2 통합 계층)
+};
+
+/**
+ * @class ProcPidReader
+ * @brief /proc/[pid]의 필요한 파일만 pread로 읽어 직접 파싱하는 리더
+ *
+ * libprocps의 readproc처럼 여러 파일을 범용 파서로 읽고 명령행 배열을 할당하는 대신,
+ * 요청한 항목 그룹의 파일만 열어 리더가 가진 버퍼에 pread로 읽고 정수를 직접 파싱합니다.
+ * 버퍼는 리더 인스턴스에 속하므로 스레드마다 리더를 하나씩 두면 잠금 없이 재사용됩니다.
+ * PID 목록은 listPids()로 얻고, 읽을 항목 그룹은 read() 호출마다 지정합니다.
+ */
+class ProcPidReader
+{
+public:
+    /**
+     * @brief 읽을 항목 그룹 (비트 OR로 조합)
+     */
+    enum Field : unsigned
+    {
+        Stat = 1u << 0,    ///< /proc/[pid]/stat (이름, 상태, 부모, CPU 시간, nice, 스레드 수, 시작 시각)
+        Statm = 1u << 1,   ///< /proc/[pid]/statm (가상/상주 메모리)
+        Cmdline = 1u << 2, ///< /proc/[pid]/cmdline (명령행)
+        Owner = 1u << 3,   ///< /proc/[pid] 디렉토리 소유자 (사용자 ID)
+        Io = 1u << 4,      ///< /proc/[pid]/io (읽기/쓰기 바이트, 다른 사용자의 프로세스는 권한 필요)
+        Fds = 1u << 5,     ///< /proc/[pid]/fd (열린 파일 디스크립터 수)
+        Cgroup = 1u << 6   ///< /proc/[pid]/cgroup (cgroup 경로)
+    };
+
+    /**
+     * @brief 리더 생성자 - PID 지정 읽기에 사용할 /proc 디렉토리를 엶
+     */
+    ProcPidReader();
+
+    /**
+     * @brief 리더 소멸자 - 열린 /proc 디렉토리를 닫음
+     */
+    ~ProcPidReader();
+
+    ProcPidReader(const ProcPidReader &) = delete;
+    ProcPidReader &operator=(const ProcPidReader &) = delete;
+
+    /**
+     * @brief 지정한 프로세스 하나의 정보 중 요청한 항목 그룹만 읽음
+     *
+     * 이미 알고 있는 프로세스의 정적 항목(명령행, 소유자)은 요청하지 않고 건너뜁니다.
+     *
+     * @param pid 프로세스 ID
+     * @param sample 결과를 채울 객체 (요청하지 않은 필드는 그대로 유지)
+     * @param fields 이번 호출에서 읽을 항목 그룹 (Field 값의 비트 OR)
+     * @return bool 프로세스가 존재하고 요청한 파일을 모두 읽었으면 true
+     */
+    bool read(pid_t pid, ProcPidSample &sample, unsigned fields);
+
+    /**
+     * @brief 프로세스에 속한 스레드(태스크) ID 목록을 읽음
+     *
+     * @param pid 프로세스 ID
+     * @param tids 결과를 채울 벡터 (기존 내용은 지워지고 용량은 재사용)
+     * @return bool /proc/[pid]/task를 읽을 수 있으면 true
+     */
+    bool listTasks(pid_t pid, vector<pid_t> &tids);
+
+    /**
+     * @brief 스레드 하나의 /proc/[pid]/task/[tid]/stat을 읽음
+     *
+     * @param pid 프로세스 ID
+     * @param tid 스레드 ID
+     * @param sample 결과를 채울 객체 (stat 항목만 갱신)
+     * @return bool 스레드가 존재하고 stat을 읽었으면 true
+     */
+    bool readTask(pid_t pid, pid_t tid, ProcPidSample &sample);
+
+    /**
+     * @brief 현재 존재하는 모든 프로세스의 PID 목록을 읽음
+     *
+     * @param pids 결과를 채울 벡터 (기존 내용은 지워지고 용량은 재사용)
+     * @return bool /proc를 읽을 수 있으면 true
+     */
+    static bool listPids(vector<pid_t> &pids);
+
+private:
+    int procFd_;          ///< PID 지정 읽기에 사용하는 /proc 디렉토리 파일 디스크립터
+    vector<char> buffer_; ///< 파일 내용을 읽는 재사용 버퍼
+    uint64_t pageSize_;   ///< 메모리 페이지 크기 (statm 변환용)
+
+    /**
+     * @brief 프로세스 디렉토리 하나에서 요청한 항목을 읽음
+     *
+     * @param procFd /proc 디렉토리 파일 디스크립터
+     * @param name 프로세스 디렉토리 이름 (PID 문자열)
+     * @param sample 결과를 채울 객체
+     * @param fields 읽을 항목 그룹
+     * @return bool 요청한 파일을 모두 읽었으면 true
+     */
+    bool readPid(int procFd, const char *name, ProcPidSample &sample, unsigned fields);
+
+    /**
+     * @brief 파일 전체를 buffer_에 읽음 (필요하면 버퍼를 키움)
+     *
+     * @param dirFd 파일이 있는 디렉토리 파일 디스크립터
+     * @param name 파일 이름
+     * @param length 읽은 바이트 수
+     * @return bool 읽었으면 true
+     */
+    bool readFile(int dirFd, const char *name, size_t &length);
+
+    /**
+     * @brief /proc/[pid]/stat 내용을 파싱
+     *
+     * @param length buffer_에 읽은 바이트 수
+     * @param sample 결과를 채울 객체
+     * @return bool 형식이 올바르면 true
+     */
+    bool parseStat(size_t length, ProcPidSample &sample) const;
+
+    /**
+     * @brief /proc/[pid]/statm 내용을 파싱
+     *
+     * @param length buffer_에 읽은 바이트 수
+     * @param sample 결과를 채울 객체
+     * @return bool 형식이 올바르면 true
+     */
+    bool parseStatm(size_t length, ProcPidSample &sample) const;
+
+    /**
+     * @brief /proc/[pid]/io 내용을 파싱
+     *
+     * @param length buffer_에 읽은 바이트 수
+     * @param sample 결과를 채울 객체
+     */
+    void parseIo(size_t length, ProcPidSample &sample) const;
+
+    /**
+     * @brief /proc/[pid]/cgroup 내용을 파싱
+     *
+     * @param length buffer_에 읽은 바이트 수
+     * @param sample 결과를 채울 객체
+     */
+    void parseCgroup(size_t length, ProcPidSample &sample) const;
+
+    /**
+     * @brief 프로세스의 열린 파일 디스크립터 수를 셈
+     *
+     * 커널이 /proc/[pid]/fd 디렉토리의 st_size로 디스크립터 수를 알려주면(리눅스 6.2 이상) 그 값을 쓰고,
+     * 아니면 getdents64로 buffer_에 디렉토리 항목을 읽어 셉니다.
+     *
+     * @param pidFd 프로세스 디렉토리 파일 디스크립터
+     * @param count 열린 파일 디스크립터 수
+     * @return bool 셀 수 있었으면 true
+     */
+    bool countFds(int pidFd, int &count);
+};
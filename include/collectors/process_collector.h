@@ -4,9 +4,17 @@
  * @brief 시스템 프로세스 정보 수집 및 관리를 위한 클래스 정의
  */
 #include "collector.h"
+#include "proc_pid_reader.h"
+#include "proc_connector.h"
 #include "../models/process_info.h"
+#include "../models/process_group_info.h"
+#include "config/collector_options.h"
+#include <chrono>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <functional>
@@ -31,16 +39,243 @@ private:
     alignas(64) vector<ProcessInfo> processes;
 
     /**
-     * @brief 이전 CPU 시간 측정값을 저장하는 맵 (PID별)
+     * @brief 초당 클럭 틱 수 (생성 시 한 번만 조회)
      * @note 캐시 라인 정렬(64바이트)을 통해 성능 최적화
      */
-    alignas(64) map<pid_t, pair<unsigned long, unsigned long>> prev_cpu_times;
+    alignas(64) unsigned long clk_tck;
 
     /**
-     * @brief 이전 총 CPU 시간
-     * @note 캐시 라인 정렬(64바이트)을 통해 성능 최적화
+     * @brief 온라인 CPU 수 (수집 주기마다 갱신, 샤드 작업에서는 읽기 전용)
+     */
+    unsigned online_cpus = 1;
+
+    /**
+     * @brief 프로세스 수집 옵션
+     */
+    ProcessOptions options;
+
+    /**
+     * @brief 최대 샤드 수
+     */
+    static constexpr size_t MAX_SHARDS = 16;
+
+    /**
+     * @brief 이벤트 기반 수집 중에도 /proc 전체를 다시 읽는 주기 (수집 횟수)
+     */
+    static constexpr uint64_t FULL_RESCAN_CYCLES = 12;
+
+    /**
+     * @brief 프로세스 생명주기 이벤트 리스너 (비활성화되었거나 구독에 실패하면 nullptr)
+     */
+    unique_ptr<ProcConnector> connector;
+
+    /**
+     * @brief 직전 수집 이후 수신한 생명주기 이벤트
+     */
+    vector<ProcessEventInfo> events;
+
+    /**
+     * @brief 직전 수집 이후 생성 이벤트로 알게 된 PID 목록 (주기 간 용량 재사용)
+     */
+    vector<pid_t> new_pids;
+
+    /**
+     * @brief 스레드 테이블의 항목 하나 (스레드 단위 수집 대상 프로세스만 사용)
+     */
+    struct ThreadEntry
+    {
+        unsigned long long start_ticks = 0; ///< 부팅 후 시작 시각 (클럭 틱, TID 재사용 판별용)
+        unsigned long prev_cpu_ticks = 0;   ///< 직전 주기의 누적 CPU 시간 (클럭 틱)
+        chrono::steady_clock::time_point prev_sample_time; ///< 직전 주기에 stat을 읽은 시각
+        uint64_t seen_cycle = 0;            ///< 마지막으로 관측된 수집 주기 번호
+    };
+
+    /**
+     * @brief 프로세스 테이블의 항목 하나
+     *
+     * 정적 필드(이름, 사용자, 명령행, 시작 시각)는 PID가 처음 관측될 때만 채우고,
+     * 이후 주기에는 동적 필드만 갱신합니다.
+     */
+    struct ProcessEntry
+    {
+        unsigned long long start_ticks = 0; ///< 부팅 후 시작 시각 (클럭 틱, PID 재사용 판별용)
+        unsigned long prev_cpu_ticks = 0;   ///< 직전 주기의 누적 CPU 시간 (클럭 틱)
+        chrono::steady_clock::time_point prev_sample_time; ///< 직전 주기에 stat을 읽은 시각
+        uint64_t prev_io_bytes = 0;         ///< 직전 주기의 누적 읽기+쓰기 바이트 (I/O 순위용)
+        double rank_key = 0.0;              ///< 이번 주기의 상위 K개 선택 기준 값
+        string cgroup;                      ///< cgroup 경로 (cgroup 합산을 켠 경우에만 채움)
+        unordered_map<pid_t, ThreadEntry> threads; ///< TID별 스레드 테이블 (스레드 단위 수집 대상만 채움)
+        uint64_t seen_cycle = 0;            ///< 마지막으로 관측된 수집 주기 번호
+        ProcessInfo info;                   ///< 프로세스 정보
+    };
+
+    /**
+     * @brief 상위 K개 후보 (순위 기준 값, 테이블 항목)
+     */
+    using RankedEntry = pair<double, const ProcessEntry *>;
+
+    /**
+     * @brief PID 목록의 한 조각을 처리하는 작업 단위
+     *
+     * PID는 pid % 샤드 수로 샤드에 배정되므로 같은 PID는 항상 같은 샤드에서 처리되고,
+     * 샤드별 상태(리더 버퍼, 프로세스 테이블, 사용자 이름 캐시)는 잠금 없이 해당 샤드 작업만 접근합니다.
+     * @note 캐시 라인 정렬(64바이트)로 샤드 간 거짓 공유를 방지
+     */
+    struct alignas(64) Shard
+    {
+        /** @brief /proc/[pid]의 항목을 읽는 리더 (호출마다 항목 그룹을 지정, 수집 주기 간 버퍼 재사용) */
+        ProcPidReader reader;
+
+        /** @brief 프로세스 하나를 읽을 때 재사용하는 원시 값 버퍼 */
+        ProcPidSample sample;
+
+        /** @brief 이번 주기에 이 샤드가 처리할 PID 목록 */
+        vector<pid_t> pids;
+
+        /** @brief 직전 주기 이후 exec 이벤트를 받은 PID (프로세스 이벤트 수신 시에만 채움) */
+        unordered_set<pid_t> exec_pids;
+
+        /**
+         * @brief (PID, 시작 시각)으로 식별되는 프로세스 테이블
+         *
+         * 시작 시각이 달라진 PID는 재사용된 것으로 보고 새 항목으로 다시 채우며,
+         * 이번 주기에 관측되지 않은 항목은 주기 끝에 제거됩니다.
+         */
+        unordered_map<pid_t, ProcessEntry> table;
+
+        /** @brief 사용자 이름 캐시 (UID별, StringPool에 인터닝된 문자열) */
+        map<uid_t, string_view> user_cache;
+
+        /** @brief 이 샤드의 상위 K개 후보 (기준 값이 가장 작은 후보가 맨 앞인 최소 힙) */
+        vector<RankedEntry> top;
+
+        /** @brief 허용 목록에 있어 순위와 관계없이 포함할 항목 */
+        vector<const ProcessEntry *> pinned;
+
+        /** @brief 스레드 단위 수집 시 TID 목록 버퍼 */
+        vector<pid_t> tids;
+
+        /** @brief 스레드 하나를 읽을 때 재사용하는 원시 값 버퍼 */
+        ProcPidSample task_sample;
+    };
+
+    /**
+     * @brief 샤드 목록 (첫 수집 시 작업자 풀 크기에 맞춰 생성)
+     */
+    vector<unique_ptr<Shard>> shards;
+
+    /**
+     * @brief 이번 주기의 전체 PID 목록 (주기 간 용량 재사용)
+     */
+    vector<pid_t> all_pids;
+
+    /**
+     * @brief 수집 주기 번호 (프로세스 테이블의 종료 프로세스 판별용)
+     */
+    uint64_t cycle = 0;
+
+    /**
+     * @brief 상위 N개 선택에 사용하는 인덱스 버퍼 (주기 간 용량 재사용)
+     */
+    vector<size_t> detail_order;
+
+    /**
+     * @brief 샤드별 상위 K개 후보를 모으는 버퍼 (주기 간 용량 재사용)
+     */
+    vector<RankedEntry> top_candidates;
+
+    /**
+     * @brief 프로세스 트리별 합산 결과
      */
-    alignas(64) unsigned long prev_total_time = 0;
+    vector<ProcessGroupInfo> process_trees;
+
+    /**
+     * @brief cgroup별 합산 결과
+     */
+    vector<ProcessGroupInfo> cgroups;
+
+    /**
+     * @brief 합산에 사용하는 전체 테이블 항목 목록 (주기 간 용량 재사용)
+     */
+    vector<const ProcessEntry *> group_entries;
+
+    /**
+     * @brief PID → group_entries 인덱스
+     */
+    unordered_map<pid_t, size_t> group_index;
+
+    /**
+     * @brief 부모 → 자식 인덱스 (CSR 형식: child_offsets[i]부터 child_offsets[i + 1] 전까지가 i의 자식)
+     */
+    vector<size_t> child_offsets;
+
+    /**
+     * @brief child_offsets가 가리키는 자식 인덱스 배열
+     */
+    vector<size_t> children;
+
+    /**
+     * @brief 트리 순회에 사용하는 명시적 스택
+     */
+    vector<size_t> group_stack;
+
+    /**
+     * @brief cgroup 경로 → cgroups 인덱스
+     */
+    unordered_map<string, size_t> cgroup_index;
+
+    /**
+     * @brief 모든 프로세스를 프로세스 트리와 cgroup 단위로 합산
+     * @note 상위 K개 선택과 무관하게 테이블 전체를 대상으로 합니다
+     */
+    void aggregateGroups();
+
+    /**
+     * @brief 샤드별 프로세스 테이블을 processes로 합침
+     * @note ProcessOptions::topK가 0보다 크면 상위 K개와 허용 목록 항목만 복사합니다
+     */
+    void mergeShards();
+
+    /**
+     * @brief CPU 사용률 상위 프로세스에만 I/O 통계와 열린 파일 수를 채움
+     * @note ProcessOptions의 ioLimit, fdLimit 중 양수인 항목만 처리합니다
+     */
+    void collectTopDetails();
+
+    /**
+     * @brief 샤드 작업에서 모든 프로세스의 /proc/[pid]/io를 읽어야 하는지 여부
+     * @return ioLimit이 전체(-1)이거나, I/O 순위를 매기거나, 합산 정보의 I/O 합계가 필요하면 true
+     * @note ioLimit이 0(off)이면 합산을 켜도 읽지 않으므로 합산 정보의 I/O 합계는 0입니다
+     */
+    bool readsAllIo() const;
+
+    /**
+     * @brief 샤드 하나에 배정된 프로세스들의 정보를 수집
+     * @param shard 처리할 샤드
+     * @param boot_time 시스템 부팅 시각
+     * @param current_cycle 이번 수집 주기 번호
+     */
+    void collectShard(Shard &shard, time_t boot_time, uint64_t current_cycle);
+
+    /**
+     * @brief 두 샘플 사이의 누적 CPU 시간 증가량으로 CPU 사용률을 계산
+     * @param ticks 이번 샘플의 누적 CPU 시간 (클럭 틱)
+     * @param prev_ticks 직전 샘플의 누적 CPU 시간 (클럭 틱)
+     * @param now 이번 샘플 시각
+     * @param prev 직전 샘플 시각
+     * @param core_usage 코어 하나 대비 사용률 (%, 여러 코어를 쓰면 100 초과)
+     * @return 전체 머신 대비 사용률 (%)
+     */
+    float cpuUsage(unsigned long ticks, unsigned long prev_ticks, chrono::steady_clock::time_point now,
+                   chrono::steady_clock::time_point prev, float &core_usage) const;
+
+    /**
+     * @brief 프로세스 하나의 스레드별 CPU 사용량을 수집
+     * @param shard 프로세스가 배정된 샤드
+     * @param entry 프로세스 테이블 항목 (info.thread_details를 채움)
+     * @param current_cycle 이번 수집 주기 번호
+     */
+    void collectThreads(Shard &shard, ProcessEntry &entry, uint64_t current_cycle);
 
     /**
      * @brief CPU 사용량 기준으로 정렬된 프로세스 목록 반환
@@ -78,12 +313,15 @@ private:
     /**
      * @brief 프로세스 상태 문자열을 사용자 친화적인 형태로 변환
      * @param status 원본 프로세스 상태 문자열
-     * @return 변환된 상태 문자열
+     * @return 변환된 상태 문자열 (정적 문자열 또는 인터닝된 문자열)
      */
-    string convertStatus(string_view status) const;
+    string_view convertStatus(string_view status) const;
 
     /**
      * @brief CPU 사용량이 가장 높은 n개 프로세스 반환
+     *
+     * getTopProcessesBy* 함수들은 전체 목록을 복사하지 않고 상위 count개만 부분 정렬하며 복사합니다.
+     *
      * @param count 반환할 프로세스 수
      * @return CPU 사용량 상위 프로세스 목록
      */
@@ -116,6 +354,12 @@ public:
      */
     static const int MAX_SORT_BY = 3;
 
+    /**
+     * @brief 프로세스 수집기 생성자
+     * @param processOptions 프로세스 수집 옵션 (기본값: 모든 프로세스의 I/O와 열린 파일 수 수집)
+     */
+    explicit ProcessCollector(const ProcessOptions &processOptions = ProcessOptions());
+
     /**
      * @brief 프로세스 정보 수집 실행
      * @note 이 메서드는 Collector 기본 클래스의 가상 메서드를 오버라이드합니다
@@ -129,6 +373,13 @@ public:
      */
     vector<ProcessInfo> getProcesses(int sort_by) const;
 
+    /**
+     * @brief 지정된 정렬 방식으로 프로세스 목록을 기존 벡터에 채움
+     * @param sort_by 정렬 기준 (0: CPU, 1: 메모리, 2: PID, 3: 이름)
+     * @param out 결과를 채울 벡터 (기존 용량 재사용)
+     */
+    void getProcesses(int sort_by, vector<ProcessInfo> &out) const;
+
     /**
      * @brief 지정된 정렬 방식으로 상위 n개 프로세스 반환
      * @param sort_by 정렬 기준 (0: CPU, 1: 메모리, 2: PID, 3: 이름)
@@ -137,6 +388,24 @@ public:
      */
     vector<ProcessInfo> getTopProcesses(int sort_by, size_t count) const;
 
+    /**
+     * @brief 프로세스 트리별 합산 정보 반환 (CPU 사용률 내림차순)
+     * @return 프로세스 트리별 합산 정보 목록 (ProcessOptions::groupTrees가 꺼져 있으면 비어 있음)
+     */
+    const vector<ProcessGroupInfo> &getProcessTrees() const { return process_trees; }
+
+    /**
+     * @brief cgroup별 합산 정보 반환 (CPU 사용률 내림차순)
+     * @return cgroup별 합산 정보 목록 (ProcessOptions::groupCgroups가 꺼져 있으면 비어 있음)
+     */
+    const vector<ProcessGroupInfo> &getCgroups() const { return cgroups; }
+
+    /**
+     * @brief 직전 수집 이후 수신한 프로세스 생명주기 이벤트 반환 (오래된 순)
+     * @return 생명주기 이벤트 목록 (ProcessOptions::processEvents가 꺼져 있거나 구독에 실패하면 비어 있음)
+     */
+    const vector<ProcessEventInfo> &getProcessEvents() const { return events; }
+
     /**
      * @brief 지정된 PID의 프로세스 종료
      * @param pid 종료할 프로세스의 PID
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <condition_variable>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+using namespace std;
+
+/**
+ * @file blocking_pool.h
+ * @brief 무기한 멈출 수 있는 시스템 호출을 실행하는 가변 크기 스레드 풀 정의
+ */
+
+/**
+ * @class BlockingPool
+ * @brief 응답하지 않는 NFS 마운트의 statvfs처럼 끝나지 않을 수 있는 호출을 위한 풀
+ *
+ * 유휴 스레드가 없으면 최대 스레드 수까지 스레드를 새로 만들고, 유휴 시간이 지난 스레드는 종료한다.
+ * 스레드는 분리(detach)되어 풀 상태를 공유 소유하므로, 멈춘 호출은 그 스레드 하나만 붙잡을 뿐
+ * WorkerPool의 작업자나 풀 소멸을 막지 않는다. 멈춘 스레드가 최대 수에 이르면
+ * 새 작업은 큐에서 기다리며, 호출자는 future의 제한 시간으로 이를 감지한다.
+ */
+class BlockingPool
+{
+public:
+    /**
+     * @brief 기본 최대 스레드 수
+     */
+    static constexpr size_t DEFAULT_MAX_THREADS = 16;
+
+    /**
+     * @brief 기본 유휴 스레드 종료 시간
+     */
+    static constexpr chrono::seconds DEFAULT_IDLE_TIMEOUT{30};
+
+    /**
+     * @brief 풀 생성자 (스레드는 첫 작업 제출 시 만들어짐)
+     *
+     * @param maxThreads 동시에 존재할 수 있는 최대 스레드 수 (최소 1)
+     * @param idleTimeout 유휴 스레드가 종료되기까지의 시간
+     */
+    explicit BlockingPool(size_t maxThreads = DEFAULT_MAX_THREADS,
+                          chrono::milliseconds idleTimeout = DEFAULT_IDLE_TIMEOUT);
+
+    /**
+     * @brief 풀 소멸자
+     *
+     * 대기 중인 작업은 폐기하고(future는 broken_promise로 완료) 유휴 스레드를 깨워 종료시킨다.
+     * 실행 중인 스레드는 기다리지 않으며, 호출이 끝나면 스스로 종료한다.
+     */
+    ~BlockingPool();
+
+    BlockingPool(const BlockingPool &) = delete;
+    BlockingPool &operator=(const BlockingPool &) = delete;
+
+    /**
+     * @brief 프로세스 전체에서 공유하는 풀 반환
+     *
+     * @return BlockingPool& 공유 풀
+     */
+    static BlockingPool &shared();
+
+    /**
+     * @brief 작업을 풀에 제출
+     *
+     * @tparam F 호출 가능한 작업 타입
+     * @param task 실행할 작업 (작업이 참조하는 데이터는 호출자가 포기한 뒤에도 유효해야 함)
+     * @return future 작업 결과를 받을 future 객체
+     */
+    template <typename F>
+    auto submit(F &&task) -> future<invoke_result_t<decay_t<F>>>
+    {
+        using Result = invoke_result_t<decay_t<F>>;
+        auto packaged = make_shared<packaged_task<Result()>>(forward<F>(task));
+        future<Result> result = packaged->get_future();
+        push([packaged]()
+             { (*packaged)(); });
+        return result;
+    }
+
+    /**
+     * @brief 현재 존재하는 스레드 수 반환 (멈춘 스레드 포함)
+     *
+     * @return size_t 스레드 수
+     */
+    size_t threadCount() const;
+
+private:
+    /**
+     * @brief 풀과 스레드가 공유하는 상태
+     */
+    struct State
+    {
+        mutex stateMutex;                    ///< 상태 접근 동기화를 위한 뮤텍스
+        condition_variable wakeUp;           ///< 새 작업 도착을 알리는 조건 변수
+        deque<function<void()>> tasks;       ///< 대기 중인 작업 목록
+        size_t threads = 0;                  ///< 존재하는 스레드 수
+        size_t idle = 0;                     ///< 작업을 기다리는 스레드 수
+        size_t maxThreads = 1;               ///< 최대 스레드 수
+        chrono::milliseconds idleTimeout{0}; ///< 유휴 스레드 종료 시간
+        bool stop = false;                   ///< 종료 신호 플래그
+    };
+
+    shared_ptr<State> state_; ///< 공유 상태
+
+    /**
+     * @brief 작업을 큐에 추가하고 필요하면 스레드를 새로 만듦
+     *
+     * @param task 추가할 작업
+     */
+    void push(function<void()> task);
+
+    /**
+     * @brief 스레드 메인 루프
+     *
+     * @param state 공유 상태
+     */
+    static void threadLoop(shared_ptr<State> state);
+};
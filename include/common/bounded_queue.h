@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief 큐가 가득 찼을 때 push의 동작 방식
+ */
+enum class OverflowPolicy
+{
+    Block,      ///< 공간이 생길 때까지 생산자를 대기시킴
+    DropOldest, ///< 가장 오래된 아이템을 버리고 새 아이템을 추가
+    DropNewest, ///< 새 아이템을 버림
+    Coalesce    ///< 가장 최근 아이템을 새 아이템으로 대체 (최신 상태만 유지)
+};
+
+/**
+ * @brief 파이프라인에서 사용할 큐 구현 종류
+ */
+enum class QueueKind
+{
+    Mutex, ///< 뮤텍스와 조건 변수 기반 ThreadSafeQueue
+    Spsc   ///< 잠금 없는 단일 생산자/단일 소비자 링 버퍼 SpscRingBuffer
+};
+
+/**
+ * @brief 파이프라인 큐 생성 옵션
+ */
+struct QueueOptions
+{
+    QueueKind kind = QueueKind::Mutex;                    ///< 큐 구현 종류
+    OverflowPolicy overflow = OverflowPolicy::DropOldest; ///< 가득 찼을 때 push 동작 (소비자가 멈춰도 생산자가 대기하지 않음)
+};
+
+/**
+ * @brief 크기가 제한된 생산자-소비자 큐 인터페이스
+ *
+ * 수집기 관리자 → 데이터 전송기, 로그 캡처 → 로그 전송기 파이프라인이
+ * 구현(ThreadSafeQueue, SpscRingBuffer)과 무관하게 큐를 사용할 수 있도록 한다
+ *
+ * @tparam T 큐에 저장될 요소의 타입
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+    virtual ~BoundedQueue() = default;
+
+    /**
+     * @brief 큐에 아이템 추가 (가득 찼을 때의 동작은 구현의 OverflowPolicy를 따름)
+     *
+     * @param item 큐에 추가할 아이템
+     * @return bool 아이템이 큐에 들어갔으면 true (종료 신호 수신 또는 버려진 경우 false)
+     */
+    virtual bool push(T item) = 0;
+
+    /**
+     * @brief 대기 없이 큐에 아이템 추가를 시도
+     *
+     * @param item 큐에 추가할 아이템
+     * @return bool 추가됐으면 true (가득 찼거나 종료 신호 수신 시 false)
+     */
+    virtual bool try_push(T item) = 0;
+
+    /**
+     * @brief 지정된 시간 동안 큐에서 아이템을 가져오려고 시도
+     *
+     * @param item 가져온 아이템을 저장할 참조 변수
+     * @param timeout 대기할 최대 시간
+     * @return bool 성공 여부 (false: 타임아웃 또는 종료 신호)
+     */
+    virtual bool try_pop(T &item, chrono::milliseconds timeout) = 0;
+
+    /**
+     * @brief 종료 신호 발생 - 대기 중인 모든 스레드를 깨움
+     */
+    virtual void terminate() = 0;
+
+    /**
+     * @brief 큐가 비어있는지 확인
+     *
+     * @return bool 큐가 비어있으면 true
+     */
+    virtual bool empty() const = 0;
+
+    /**
+     * @brief 현재 큐에 저장된 아이템 개수 반환
+     *
+     * @return size_t 큐에 저장된 아이템 개수
+     */
+    virtual size_t size() const = 0;
+
+    /**
+     * @brief 가득 차서 버려지거나 대체된 누적 아이템 수 반환
+     *
+     * @return uint64_t 버려진 아이템 수
+     */
+    virtual uint64_t dropped() const = 0;
+};
@@ -0,0 +1,149 @@
+#pragma once
+/**
+ * @file proc_file.h
+ * @brief 열린 fd를 재사용해 procfs 파일을 할당 없이 읽고 파싱하는 리더 정의
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief 키-값 형식 procfs 파일에서 찾을 키와 값을 저장할 위치
+ *
+ * key는 줄 맨 앞에서 비교하는 접두사(구분자 포함, 예: "MemTotal:")이며,
+ * 값은 키 뒤의 공백을 건너뛴 첫 번째 부호 없는 정수입니다.
+ */
+struct ProcField
+{
+    string_view key; ///< 줄 접두사
+    uint64_t *value; ///< 파싱한 값을 저장할 위치
+};
+
+/**
+ * @class ProcFile
+ * @brief procfs 파일 하나를 반복해서 읽는 리더
+ *
+ * 처음 읽을 때 연 fd를 유지하고 매번 오프셋 0부터 pread로 리더가 가진 버퍼에 읽습니다.
+ * 버퍼는 파일이 더 클 때만 늘어나므로 안정 상태에서는 할당이 없으며,
+ * 내용은 contents()의 string_view로 파싱합니다. 스레드 간 공유하려면 SharedProcFile을 사용합니다.
+ */
+class ProcFile
+{
+public:
+    /**
+     * @brief 리더 생성자 (파일은 처음 read() 호출 시 열림)
+     *
+     * @param path 읽을 파일 경로 (리더보다 오래 유지되어야 함)
+     * @param capacity 초기 버퍼 크기 (바이트)
+     */
+    explicit ProcFile(const char *path, size_t capacity = 4096);
+
+    /**
+     * @brief 리더 소멸자 - 열린 fd를 닫음
+     */
+    ~ProcFile();
+
+    ProcFile(const ProcFile &) = delete;
+    ProcFile &operator=(const ProcFile &) = delete;
+
+    /**
+     * @brief 파일 전체를 처음부터 다시 읽음
+     *
+     * @return bool 성공하면 true (실패 시 errno 유지, 다음 호출에서 파일을 다시 엶)
+     */
+    bool read();
+
+    /**
+     * @brief 마지막으로 읽은 내용 반환
+     *
+     * @return string_view 다음 read() 호출 전까지 유효한 파일 내용
+     */
+    string_view contents() const { return string_view(buffer_.data(), size_); }
+
+    /**
+     * @brief 키-값 형식 텍스트에서 표에 지정된 키의 값을 찾아 저장
+     *
+     * 표의 모든 키를 찾으면 나머지 줄은 읽지 않습니다. 찾지 못한 키의 값은 바꾸지 않습니다.
+     *
+     * @param text 파싱할 텍스트
+     * @param fields 찾을 키 표
+     * @param count 표의 항목 수 (최대 64개)
+     * @return size_t 찾은 키 수
+     */
+    static size_t parseFields(string_view text, const ProcField *fields, size_t count);
+
+    /**
+     * @brief 공백을 건너뛰고 부호 없는 10진 정수를 파싱
+     *
+     * @param p 파싱 시작 위치
+     * @param end 텍스트 끝
+     * @param value 파싱한 값 (숫자가 없으면 0)
+     * @return const char* 숫자 바로 뒤 위치
+     */
+    static const char *parseUnsigned(const char *p, const char *end, uint64_t &value);
+
+private:
+    const char *path_;    ///< 파일 경로
+    int fd_ = -1;         ///< 열린 fd (-1이면 닫힘)
+    vector<char> buffer_; ///< 읽기 버퍼
+    size_t size_ = 0;     ///< 마지막으로 읽은 바이트 수
+};
+
+/**
+ * @class SharedProcFile
+ * @brief 여러 수집기가 같은 주기에 한 번만 읽도록 공유하는 procfs 파일
+ *
+ * 마지막으로 읽은 지 SHARE_WINDOW가 지나지 않았으면 다시 읽지 않고 같은 내용을 넘겨주므로,
+ * 같은 스케줄러 틱에 실행되는 CPU 수집기와 프로세스 수집기가 /proc/stat을 한 번만 읽습니다.
+ * 내용은 잠금을 잡은 채 콜백에 전달되므로 콜백에서는 파싱만 합니다.
+ */
+class SharedProcFile
+{
+public:
+    /**
+     * @brief 같은 내용을 재사용하는 최대 시간 (수집 스케줄러 틱 간격)
+     */
+    static constexpr chrono::milliseconds SHARE_WINDOW{100};
+
+    /**
+     * @brief 공유 /proc/stat 인스턴스 반환
+     *
+     * @return SharedProcFile& /proc/stat 리더
+     */
+    static SharedProcFile &stat();
+
+    /**
+     * @brief 최신 내용을 콜백에 전달
+     *
+     * @param fn string_view를 받는 콜백 (잠금을 잡은 채 호출됨)
+     * @return bool 파일을 읽을 수 있어 콜백을 호출했으면 true
+     */
+    template <typename Fn>
+    bool read(Fn &&fn)
+    {
+        lock_guard<mutex> lock(mutex_);
+        auto now = chrono::steady_clock::now();
+        if (!valid_ || now - readTime_ >= SHARE_WINDOW)
+        {
+            valid_ = file_.read();
+            if (!valid_)
+                return false;
+            readTime_ = now;
+        }
+        fn(file_.contents());
+        return true;
+    }
+
+private:
+    explicit SharedProcFile(const char *path) : file_(path) {}
+
+    mutex mutex_;                               ///< file_ 보호
+    ProcFile file_;                             ///< 공유 리더
+    chrono::steady_clock::time_point readTime_; ///< 마지막으로 읽은 시각
+    bool valid_ = false;                        ///< file_ 내용이 유효한지 여부
+};
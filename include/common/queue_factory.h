@@ -0,0 +1,27 @@
+#pragma once
+
+#include "common/bounded_queue.h"
+#include "common/thread_safe_queue.h"
+#include "common/spsc_ring_buffer.h"
+
+#include <memory>
+
+using namespace std;
+
+/**
+ * @brief 큐 옵션에 맞는 파이프라인 큐를 생성
+ *
+ * @tparam T 큐에 저장될 요소의 타입
+ * @param capacity 큐의 최대 크기
+ * @param options 큐 구현 종류와 가득 찼을 때 동작
+ * @return unique_ptr<BoundedQueue<T>> 생성된 큐
+ */
+template <typename T>
+unique_ptr<BoundedQueue<T>> makeBoundedQueue(size_t capacity, const QueueOptions &options = QueueOptions())
+{
+    if (options.kind == QueueKind::Spsc)
+    {
+        return make_unique<SpscRingBuffer<T>>(capacity, options.overflow);
+    }
+    return make_unique<ThreadSafeQueue<T>>(capacity, options.overflow);
+}
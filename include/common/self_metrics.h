@@ -0,0 +1,248 @@
+#pragma once
+
+#include "models/agent_info.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+using namespace std;
+
+/**
+ * @brief 에이전트 자체 계측 레지스트리
+ *
+ * 수집기별 소요 시간 히스토그램, 오류 수, 직렬화 바이트 수, 큐 깊이와 드롭 수를
+ * 고정 크기 원자 변수 배열에 기록한다. 이름 등록만 뮤텍스를 사용하고
+ * 기록 경로는 잠금 없이 원자 연산만 수행하므로 수집 경로에서 호출해도 부담이 적다.
+ */
+class SelfMetrics
+{
+public:
+    /**
+     * @brief 등록 가능한 최대 수집기 수
+     */
+    static constexpr size_t MAX_COLLECTORS = 16;
+
+    /**
+     * @brief 소요 시간 히스토그램 칸 수 (1ms 미만부터 2^14ms 이상까지 2배 간격)
+     */
+    static constexpr size_t LATENCY_BUCKETS = 16;
+
+    /**
+     * @brief 깊이를 관측하는 내부 큐 종류
+     */
+    enum class Queue : size_t
+    {
+        Metrics = 0, ///< 수집기 관리자 → 데이터 전송기 메트릭 큐
+        Logs,        ///< 로그 캡처 → 로그 전송기 로그 큐
+        Count
+    };
+
+    /**
+     * @brief 수집기 실행 하나의 소요 시간을 측정하는 RAII 타이머
+     *
+     * 생성 시점부터 소멸 시점까지의 경과 시간과 현재 스레드의 CPU 시간을 기록한다.
+     * 그 사이 같은 스레드에서 직접 실행한 하위 작업의 CPU 시간은 SubTaskTimer가 이미
+     * 기록하므로 제외한다
+     */
+    class Timer
+    {
+    public:
+        /**
+         * @brief 타이머 생성자
+         *
+         * @param slot registerCollector()가 반환한 슬롯 번호
+         */
+        explicit Timer(int slot);
+
+        /**
+         * @brief 타이머 소멸자 - 측정 결과를 레지스트리에 기록
+         */
+        ~Timer();
+
+        Timer(const Timer &) = delete;
+        Timer &operator=(const Timer &) = delete;
+
+    private:
+        int slot_;                               ///< 기록할 슬롯 번호
+        chrono::steady_clock::time_point start_; ///< 측정 시작 시각
+        chrono::nanoseconds cpuStart_;           ///< 측정 시작 시점의 스레드 CPU 시간
+        chrono::nanoseconds attributedStart_;    ///< 측정 시작 시점까지 이 스레드에서 기록된 CPU 시간
+    };
+
+    /**
+     * @brief 수집기 하위 작업 하나의 CPU 시간을 소유 수집기에 더하는 RAII 타이머
+     *
+     * 하위 작업이 다른 작업자 스레드에서 실행되어도 CPU 시간이 소유 수집기의 cpu_ms에 포함되도록
+     * 작업을 실행하는 스레드에서 측정한다. 실행 횟수와 소요 시간은 기록하지 않는다
+     */
+    class SubTaskTimer
+    {
+    public:
+        /**
+         * @brief 타이머 생성자
+         *
+         * @param slot 소유 수집기의 슬롯 번호 (음수이면 기록하지 않음)
+         */
+        explicit SubTaskTimer(int slot);
+
+        /**
+         * @brief 타이머 소멸자 - CPU 시간을 레지스트리에 기록
+         */
+        ~SubTaskTimer();
+
+        SubTaskTimer(const SubTaskTimer &) = delete;
+        SubTaskTimer &operator=(const SubTaskTimer &) = delete;
+
+    private:
+        int slot_;                            ///< 기록할 슬롯 번호
+        chrono::nanoseconds cpuStart_;        ///< 측정 시작 시점의 스레드 CPU 시간
+        chrono::nanoseconds attributedStart_; ///< 측정 시작 시점까지 이 스레드에서 기록된 CPU 시간
+    };
+
+    /**
+     * @brief 전역 레지스트리 인스턴스 반환
+     *
+     * @return SelfMetrics& 레지스트리 인스턴스
+     */
+    static SelfMetrics &instance();
+
+    /**
+     * @brief 수집기 이름으로 슬롯을 등록하거나 기존 슬롯을 조회
+     *
+     * @param name 수집기 이름
+     * @return int 슬롯 번호 (슬롯이 가득 찼으면 -1)
+     */
+    int registerCollector(const string &name);
+
+    /**
+     * @brief 수집기 실행 한 번의 결과를 기록
+     *
+     * @param slot 슬롯 번호 (음수이면 무시)
+     * @param elapsed 경과 시간
+     * @param cpuTime 실행 스레드에서 소비한 CPU 시간 (하위 작업 타이머가 기록한 부분 제외)
+     */
+    void recordRun(int slot, chrono::nanoseconds elapsed, chrono::nanoseconds cpuTime);
+
+    /**
+     * @brief 수집기 하위 작업이 소비한 CPU 시간을 더함
+     *
+     * @param slot 슬롯 번호 (음수이면 무시)
+     * @param cpuTime 하위 작업을 실행한 스레드에서 소비한 CPU 시간
+     */
+    void recordCpu(int slot, chrono::nanoseconds cpuTime);
+
+    /**
+     * @brief 수집기 오류를 기록
+     *
+     * @param slot 슬롯 번호 (음수이면 무시)
+     */
+    void recordError(int slot);
+
+    /**
+     * @brief 직렬화한 스냅샷 하나의 크기를 기록
+     *
+     * @param bytes 직렬화된 바이트 수
+     */
+    void recordSerialized(size_t bytes);
+
+    /**
+     * @brief 스케줄러가 건너뛴 틱 수를 기록
+     *
+     * @param ticks 건너뛴 틱 수
+     */
+    void recordTickOverrun(uint64_t ticks);
+
+    /**
+     * @brief 발행 시점을 놓쳐 건너뛴 발행 주기 수를 기록
+     *
+     * @param cycles 건너뛴 발행 주기 수
+     */
+    void recordMissedCycles(uint64_t cycles);
+
+    /**
+     * @brief 내부 큐의 현재 깊이와 누적 드롭 수를 기록
+     *
+     * @param queue 큐 종류
+     * @param depth 현재 깊이
+     * @param dropped 가득 차서 버려지거나 대체된 누적 아이템 수
+     */
+    void setQueueState(Queue queue, size_t depth, uint64_t dropped);
+
+    /**
+     * @brief 수집기의 현재 적용 중인 수집 주기를 기록
+     *
+     * @param slot 슬롯 번호 (음수이면 무시)
+     * @param period 변화량과 CPU 예산에 따라 조정된 수집 주기
+     */
+    void setPeriod(int slot, chrono::milliseconds period);
+
+    /**
+     * @brief CPU 예산 초과로 모든 수집 주기에 곱해지는 배율을 기록
+     *
+     * @param scale 주기 배율 (1.0이면 예산 이내)
+     */
+    void setRateScale(double scale);
+
+    /**
+     * @brief 현재까지 기록된 지표를 AgentInfo로 반환
+     *
+     * @return AgentInfo 에이전트 자체 지표
+     */
+    AgentInfo snapshot() const;
+
+    /**
+     * @brief 현재 스레드가 소비한 CPU 시간 반환
+     *
+     * @return chrono::nanoseconds 스레드 CPU 시간
+     */
+    static chrono::nanoseconds threadCpuTime();
+
+    /**
+     * @brief 에이전트 프로세스 전체가 소비한 CPU 시간 반환 (사용자 + 커널)
+     *
+     * @return chrono::nanoseconds 프로세스 CPU 시간
+     */
+    static chrono::nanoseconds processCpuTime();
+
+private:
+    /**
+     * @brief 수집기별 통계 슬롯
+     */
+    struct CollectorSlot
+    {
+        atomic<uint64_t> runs{0};                             ///< 실행 횟수
+        atomic<uint64_t> errors{0};                           ///< 오류 횟수
+        atomic<uint64_t> totalMicros{0};                      ///< 누적 소요 시간 (마이크로초)
+        atomic<uint64_t> lastMicros{0};                       ///< 마지막 소요 시간 (마이크로초)
+        atomic<uint64_t> maxMicros{0};                        ///< 최대 소요 시간 (마이크로초)
+        atomic<uint64_t> cpuMicros{0};                        ///< 누적 CPU 시간 (하위 작업 포함, 마이크로초)
+        atomic<uint64_t> periodMs{0};                         ///< 현재 수집 주기 (밀리초)
+        array<atomic<uint64_t>, LATENCY_BUCKETS> histogram{}; ///< 소요 시간 히스토그램
+    };
+
+    SelfMetrics() = default;
+
+    array<CollectorSlot, MAX_COLLECTORS> slots_;                               ///< 수집기 슬롯
+    array<string, MAX_COLLECTORS> names_;                                      ///< 슬롯별 수집기 이름 (등록 후 불변)
+    atomic<size_t> slotCount_{0};                                              ///< 등록된 슬롯 수
+    mutex registerMutex_;                                                      ///< 슬롯 등록 동기화용 뮤텍스
+    atomic<uint64_t> bytesSerialized_{0};                                      ///< 누적 직렬화 바이트 수
+    atomic<uint64_t> snapshotsSerialized_{0};                                  ///< 누적 직렬화 스냅샷 수
+    atomic<uint64_t> tickOverruns_{0};                                         ///< 누적 건너뛴 틱 수
+    atomic<uint64_t> missedCycles_{0};                                         ///< 누적 건너뛴 발행 주기 수
+    atomic<double> rateScale_{1.0};                                            ///< CPU 예산에 따른 주기 배율
+    array<atomic<uint64_t>, static_cast<size_t>(Queue::Count)> queueDepths_{}; ///< 큐별 깊이
+    array<atomic<uint64_t>, static_cast<size_t>(Queue::Count)> queueDrops_{};  ///< 큐별 누적 드롭 수
+
+    /**
+     * @brief 소요 시간에 해당하는 히스토그램 칸 번호 계산
+     *
+     * @param micros 소요 시간 (마이크로초)
+     * @return size_t 히스토그램 칸 번호
+     */
+    static size_t bucketFor(uint64_t micros);
+};
@@ -0,0 +1,292 @@
+#pragma once
+
+#include "common/bounded_queue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+using namespace std;
+
+/**
+ * @brief 잠금 없는 단일 생산자/단일 소비자(SPSC) 링 버퍼
+ *
+ * 생산자 위치(tail_)와 소비자 위치(head_)를 서로 다른 캐시 라인에 두어
+ * 생산자와 소비자가 같은 캐시 라인을 두고 경합하지 않도록 한다.
+ * 각 칸은 시퀀스 번호로 비었는지 찼는지를 표시하므로 뮤텍스 없이 원자 연산만 사용한다.
+ *
+ * OverflowPolicy::DropOldest에서는 생산자가 소비자와 같은 방식(head_ CAS)으로
+ * 가장 오래된 칸을 가져가 버리므로 소비자와 동시에 실행되어도 안전하다.
+ * 가장 최근 칸은 소비자가 동시에 꺼낼 수 있어 제자리에서 대체할 수 없으므로
+ * OverflowPolicy::Coalesce는 DropOldest와 같이 동작한다.
+ *
+ * 칸 배열은 마스크 연산을 위해 2의 거듭제곱으로 올려 할당하지만, 저장 개수는 요청한 용량으로
+ * 제한하므로 큐 구현을 바꿔도 설정한 상한과 드롭 시점이 같다.
+ *
+ * 조건 변수가 없으므로 대기는 짧은 회전 후 yield, 이후 1ms 단위 sleep으로 수행된다.
+ * 생산자가 여러 스레드인 경우 외부에서 직렬화해야 한다 (예: spdlog 싱크 뮤텍스).
+ *
+ * @tparam T 큐에 저장될 요소의 타입 (기본 생성 가능해야 함)
+ */
+template <typename T>
+class SpscRingBuffer : public BoundedQueue<T>
+{
+public:
+    /**
+     * @brief SPSC 링 버퍼 생성자
+     *
+     * @param capacity 최대 아이템 수 (최소 1, 기본값: 100)
+     * @param policy 가득 찼을 때 push 동작 (기본값: Block)
+     */
+    explicit SpscRingBuffer(size_t capacity = 100, OverflowPolicy policy = OverflowPolicy::Block)
+        : limit_(max<size_t>(capacity, 1)), capacity_(roundUpPowerOfTwo(limit_)), mask_(capacity_ - 1),
+          policy_(policy), cells_(make_unique<Cell[]>(capacity_))
+    {
+        for (size_t i = 0; i < capacity_; i++)
+        {
+            cells_[i].sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    SpscRingBuffer(const SpscRingBuffer &) = delete;
+    SpscRingBuffer &operator=(const SpscRingBuffer &) = delete;
+
+    /**
+     * @brief 큐에 아이템 추가 (생산자용)
+     *
+     * @param item 큐에 추가할 아이템
+     * @return bool 추가됐으면 true (종료 신호 수신 또는 DropNewest로 버려진 경우 false)
+     */
+    bool push(T item) override
+    {
+        if (enqueue(item))
+            return true;
+
+        if (policy_ == OverflowPolicy::DropNewest)
+        {
+            dropped_.fetch_add(1, memory_order_relaxed);
+            return false;
+        }
+
+        for (unsigned spins = 0; !terminated_.load(memory_order_acquire); spins++)
+        {
+            if (policy_ == OverflowPolicy::DropOldest || policy_ == OverflowPolicy::Coalesce)
+            {
+                T discarded;
+                if (dequeue(discarded))
+                {
+                    dropped_.fetch_add(1, memory_order_relaxed);
+                }
+            }
+
+            if (enqueue(item))
+                return true;
+
+            backoff(spins);
+        }
+        return false;
+    }
+
+    /**
+     * @brief 대기 없이 큐에 아이템 추가를 시도 (정책과 무관하게 가득 차면 실패)
+     *
+     * @param item 큐에 추가할 아이템
+     * @return bool 추가됐으면 true
+     */
+    bool try_push(T item) override
+    {
+        if (terminated_.load(memory_order_acquire))
+            return false;
+        return enqueue(item);
+    }
+
+    /**
+     * @brief 큐에서 아이템을 가져오려고 시도 (소비자용)
+     *
+     * @param item 가져온 아이템을 저장할 참조 변수
+     * @param timeout 대기할 최대 시간
+     * @return bool 성공 여부 (false: 타임아웃 또는 종료 신호)
+     */
+    bool try_pop(T &item, chrono::milliseconds timeout) override
+    {
+        auto deadline = chrono::steady_clock::now() + timeout;
+        for (unsigned spins = 0;; spins++)
+        {
+            if (terminated_.load(memory_order_acquire))
+                return false;
+            if (dequeue(item))
+                return true;
+            if (chrono::steady_clock::now() >= deadline)
+                return false;
+            backoff(spins);
+        }
+    }
+
+    /**
+     * @brief 종료 신호 발생
+     *
+     * 대기 중인 생산자와 소비자는 다음 확인 시점에 false를 반환한다
+     */
+    void terminate() override
+    {
+        terminated_.store(true, memory_order_release);
+    }
+
+    /**
+     * @brief 큐가 비어있는지 확인
+     *
+     * @return bool 큐가 비어있으면 true
+     */
+    bool empty() const override
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 현재 큐에 저장된 아이템 개수 반환 (동시 실행 중에는 근사값)
+     *
+     * @return size_t 큐에 저장된 아이템 개수
+     */
+    size_t size() const override
+    {
+        size_t head = head_.load(memory_order_acquire);
+        size_t tail = tail_.load(memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    /**
+     * @brief 최대 아이템 수 반환
+     *
+     * @return size_t 생성 시 지정한 용량
+     */
+    size_t capacity() const { return limit_; }
+
+    /**
+     * @brief 가득 차서 버려진 누적 아이템 수 반환
+     *
+     * @return uint64_t 버려진 아이템 수
+     */
+    uint64_t dropped() const override { return dropped_.load(memory_order_relaxed); }
+
+private:
+    /**
+     * @brief 캐시 라인 크기 (생산자/소비자 위치 분리용)
+     */
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * @brief 링 버퍼의 한 칸
+     */
+    struct Cell
+    {
+        atomic<size_t> sequence{0}; ///< 칸 상태 (pos: 비어 있음, pos + 1: 값 있음)
+        T value{};                  ///< 저장된 아이템
+    };
+
+    const size_t limit_;          ///< 최대 아이템 수 (요청한 용량)
+    const size_t capacity_;       ///< 링 버퍼 칸 수 (limit_ 이상의 2의 거듭제곱)
+    const size_t mask_;           ///< 위치 → 칸 번호 변환 마스크
+    const OverflowPolicy policy_; ///< 가득 찼을 때 push 동작
+    unique_ptr<Cell[]> cells_;    ///< 칸 배열
+
+    alignas(CACHE_LINE_SIZE) atomic<size_t> head_{0};         ///< 다음에 꺼낼 위치 (소비자, DropOldest 시 생산자도 CAS)
+    alignas(CACHE_LINE_SIZE) atomic<size_t> tail_{0};         ///< 다음에 넣을 위치 (생산자 전용)
+    alignas(CACHE_LINE_SIZE) atomic<bool> terminated_{false}; ///< 종료 신호 플래그
+    atomic<uint64_t> dropped_{0};                             ///< 버려진 누적 아이템 수
+
+    /**
+     * @brief 값을 2의 거듭제곱으로 올림
+     *
+     * @param value 올릴 값
+     * @return size_t value 이상의 가장 작은 2의 거듭제곱 (최소 2)
+     */
+    static size_t roundUpPowerOfTwo(size_t value)
+    {
+        size_t result = 2;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    /**
+     * @brief 대기 단계에 따라 회전, yield, sleep 중 하나를 수행
+     *
+     * @param spins 지금까지 대기한 횟수
+     */
+    static void backoff(unsigned spins)
+    {
+        if (spins < 64)
+            return;
+        if (spins < 128)
+            this_thread::yield();
+        else
+            this_thread::sleep_for(chrono::milliseconds(1));
+    }
+
+    /**
+     * @brief 저장 개수가 limit_ 미만이고 빈 칸이 있으면 아이템을 넣음 (생산자 전용)
+     *
+     * head_는 꺼내는 쪽이 값을 옮기기 전에 CAS로 먼저 올리므로, tail_ - head_가 limit_ 미만이면
+     * 칸이 아직 비워지는 중일 수는 있어도 저장 개수가 상한을 넘지는 않는다
+     *
+     * @param item 넣을 아이템 (성공한 경우에만 이동됨)
+     * @return bool 넣었으면 true
+     */
+    bool enqueue(T &item)
+    {
+        size_t pos = tail_.load(memory_order_relaxed);
+        if (pos - head_.load(memory_order_acquire) >= limit_)
+            return false;
+
+        Cell &cell = cells_[pos & mask_];
+        if (cell.sequence.load(memory_order_acquire) != pos)
+            return false;
+
+        cell.value = move(item);
+        cell.sequence.store(pos + 1, memory_order_release);
+        tail_.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 값이 있는 가장 오래된 칸에서 아이템을 꺼냄
+     *
+     * 소비자와 DropOldest 생산자가 동시에 호출할 수 있으므로 head_를 CAS로 선점한 뒤 값을 옮긴다
+     *
+     * @param item 꺼낸 아이템을 저장할 참조 변수
+     * @return bool 꺼냈으면 true
+     */
+    bool dequeue(T &item)
+    {
+        size_t pos = head_.load(memory_order_relaxed);
+        while (true)
+        {
+            Cell &cell = cells_[pos & mask_];
+            auto diff = static_cast<intptr_t>(cell.sequence.load(memory_order_acquire) - (pos + 1));
+            if (diff == 0)
+            {
+                if (head_.compare_exchange_weak(pos, pos + 1, memory_order_acq_rel, memory_order_relaxed))
+                {
+                    item = move(cell.value);
+                    cell.sequence.store(pos + capacity_, memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                // 아직 채워지지 않았거나 이전 바퀴의 값을 다른 쪽이 꺼내는 중
+                return false;
+            }
+            else
+            {
+                pos = head_.load(memory_order_relaxed);
+            }
+        }
+    }
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+using namespace std;
+
+/**
+ * @brief 프로세스 전역 문자열 인터닝 풀
+ *
+ * 프로세스 이름, 사용자 이름, 상태처럼 값의 종류는 적지만 주기마다 수백 번 복사되는 문자열을
+ * 한 번만 저장하고 string_view로 돌려준다. 저장된 문자열은 프로그램 종료까지 해제되지 않으므로
+ * 반환된 string_view는 언제까지나 유효하며, 같은 내용은 항상 같은 주소를 가리킨다.
+ *
+ * 이미 저장된 문자열 조회는 공유 잠금만 사용하므로 여러 작업자 스레드가 동시에 호출해도 경합이 적다.
+ * 풀은 줄어들지 않으므로 값의 종류가 제한된 문자열(명령행 등 고유한 값은 제외)에만 사용한다.
+ */
+class StringPool
+{
+public:
+    /**
+     * @brief 전역 풀 인스턴스 반환
+     *
+     * @return StringPool& 풀 인스턴스
+     */
+    static StringPool &instance();
+
+    /**
+     * @brief 문자열을 풀에 저장하고 풀 안의 사본을 가리키는 뷰를 반환
+     *
+     * @param value 저장할 문자열
+     * @return string_view 풀에 저장된 사본 (NUL 종료 보장)
+     */
+    string_view intern(string_view value);
+
+    /**
+     * @brief 풀에 저장된 문자열 수 반환
+     *
+     * @return size_t 저장된 문자열 수
+     */
+    size_t size() const;
+
+private:
+    StringPool() = default;
+
+    mutable shared_mutex mutex_;       ///< 저장소와 색인 보호
+    deque<string> storage_;            ///< 문자열 저장소 (deque는 끝에 추가해도 기존 요소 주소가 유지됨)
+    unordered_set<string_view> index_; ///< storage_의 문자열을 가리키는 색인
+};
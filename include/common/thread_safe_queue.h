@@ -1,9 +1,13 @@
 #pragma once
 
+#include "common/bounded_queue.h"
+
 #include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 
 using namespace std;
 
@@ -12,36 +16,62 @@ using namespace std;
  *
  * 여러 스레드에서 안전하게 사용할 수 있는 큐 자료구조
  * 생산자-소비자 패턴에 적합하며 동기화 메커니즘이 내장되어 있다
+ * 가득 찼을 때 push의 동작은 OverflowPolicy로 지정한다
  *
  * @tparam T 큐에 저장될 요소의 타입
  */
 template <typename T>
-class ThreadSafeQueue
+class ThreadSafeQueue : public BoundedQueue<T>
 {
 public:
     /**
      * @brief 스레드 안전 큐 생성자
      *
      * @param max_size 큐의 최대 크기 (기본값: 100)
+     * @param policy 가득 찼을 때 push 동작 (기본값: Block)
      */
-    ThreadSafeQueue(size_t max_size = 100) : max_size_(max_size), should_terminate_(false) {}
+    ThreadSafeQueue(size_t max_size = 100, OverflowPolicy policy = OverflowPolicy::Block)
+        : max_size_(max_size), policy_(policy), should_terminate_(false), dropped_(0) {}
 
     /**
      * @brief 큐에 아이템 추가 (생산자용)
      *
-     * 큐가 가득 찼을 경우 공간이 생길 때까지 대기한다
+     * 큐가 가득 찼을 경우 OverflowPolicy에 따라 동작한다
+     * - Block: 공간이 생길 때까지 대기
+     * - DropOldest: 가장 오래된 아이템을 버리고 추가
+     * - DropNewest: 새 아이템을 버림
+     * - Coalesce: 가장 최근 아이템을 새 아이템으로 대체
      * 종료 신호가 발생한 경우 작업을 중단한다
      *
      * @param item 큐에 추가할 아이템
-     * @return bool 성공 여부 (true: 성공, false: 종료 신호 수신됨)
+     * @return bool 성공 여부 (true: 추가 또는 대체됨, false: 종료 신호 수신 또는 DropNewest로 버려짐)
      */
-    bool push(T item)
+    bool push(T item) override
     {
         unique_lock<mutex> lock(mutex_);
 
-        // 큐가 가득 찼을 때 대기
-        not_full_.wait(lock, [this]
-                       { return queue_.size() < max_size_ || should_terminate_; });
+        if (queue_.size() >= max_size_ && !should_terminate_ && !queue_.empty())
+        {
+            switch (policy_)
+            {
+            case OverflowPolicy::DropOldest:
+                queue_.pop();
+                dropped_.fetch_add(1, memory_order_relaxed);
+                break;
+            case OverflowPolicy::DropNewest:
+                dropped_.fetch_add(1, memory_order_relaxed);
+                return false;
+            case OverflowPolicy::Coalesce:
+                queue_.back() = move(item);
+                dropped_.fetch_add(1, memory_order_relaxed);
+                return true;
+            case OverflowPolicy::Block:
+                // 큐가 가득 찼을 때 대기
+                not_full_.wait(lock, [this]
+                               { return queue_.size() < max_size_ || should_terminate_; });
+                break;
+            }
+        }
 
         if (should_terminate_)
             return false;
@@ -55,6 +85,29 @@ public:
         return true;
     }
 
+    /**
+     * @brief 대기 없이 큐에 아이템 추가를 시도
+     *
+     * 큐가 가득 찼거나 종료 신호가 발생한 경우 아이템을 버리고 즉시 반환한다
+     *
+     * @param item 큐에 추가할 아이템
+     * @return bool 성공 여부 (true: 추가됨, false: 가득 참 또는 종료 신호 수신됨)
+     */
+    bool try_push(T item) override
+    {
+        unique_lock<mutex> lock(mutex_);
+
+        if (should_terminate_ || queue_.size() >= max_size_)
+            return false;
+
+        queue_.push(move(item));
+
+        lock.unlock();
+        not_empty_.notify_one();
+
+        return true;
+    }
+
     /**
      * @brief 큐에서 아이템을 가져오려고 시도 (소비자용)
      *
@@ -65,8 +118,7 @@ public:
      * @param timeout 대기할 최대 시간
      * @return bool 성공 여부 (true: 성공, false: 타임아웃 또는 종료 신호)
      */
-    template <typename Duration>
-    bool try_pop(T& item, Duration timeout)
+    bool try_pop(T &item, chrono::milliseconds timeout) override
     {
         unique_lock<mutex> lock(mutex_);
 
@@ -95,7 +147,7 @@ public:
      *
      * 현재 대기 중인 모든 스레드에게 종료 신호를 전달한다
      */
-    void terminate()
+    void terminate() override
     {
         lock_guard<mutex> lock(mutex_);
         should_terminate_ = true;
@@ -108,7 +160,7 @@ public:
      *
      * @return bool 큐가 비어있으면 true, 그렇지 않으면 false
      */
-    bool empty() const
+    bool empty() const override
     {
         lock_guard<mutex> lock(mutex_);
         return queue_.empty();
@@ -119,17 +171,29 @@ public:
      *
      * @return size_t 큐에 저장된 아이템 개수
      */
-    size_t size() const
+    size_t size() const override
     {
         lock_guard<mutex> lock(mutex_);
         return queue_.size();
     }
 
+    /**
+     * @brief 가득 차서 버려지거나 대체된 누적 아이템 수 반환
+     *
+     * @return uint64_t 버려진 아이템 수
+     */
+    uint64_t dropped() const override
+    {
+        return dropped_.load(memory_order_relaxed);
+    }
+
 private:
     mutable mutex mutex_;           ///< 큐 접근 동기화를 위한 뮤텍스
     condition_variable not_empty_;  ///< 큐가 비어있지 않음을 알리는 조건 변수
     condition_variable not_full_;   ///< 큐가 가득 차지 않음을 알리는 조건 변수
     queue<T> queue_;                ///< 실제 데이터가 저장되는 내부 큐
     size_t max_size_;               ///< 큐의 최대 크기
+    OverflowPolicy policy_;         ///< 가득 찼을 때 push 동작
     atomic<bool> should_terminate_; ///< 종료 신호 플래그
+    atomic<uint64_t> dropped_;      ///< 버려지거나 대체된 누적 아이템 수
 };
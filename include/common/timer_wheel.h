@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief 해시드 타이머 휠 구현
+ *
+ * 고정 개수의 슬롯에 타이머를 배치하여 등록과 만료 처리를 O(1)로 수행한다
+ * 휠 한 바퀴보다 긴 지연은 남은 회전 수(rounds)로 관리한다
+ * 내부 동기화가 없으므로 하나의 스케줄러 스레드에서만 사용해야 한다
+ *
+ * @tparam T 타이머 만료 시 돌려받을 값의 타입
+ */
+template <typename T>
+class TimerWheel
+{
+public:
+    /**
+     * @brief 타이머 휠 생성자
+     *
+     * @param slotCount 휠의 슬롯 개수 (기본값: 512)
+     */
+    TimerWheel(size_t slotCount = 512) : slots_(slotCount > 0 ? slotCount : 1), current_(0), tick_(0) {}
+
+    /**
+     * @brief 지정한 틱 수 이후에 만료되는 타이머 등록
+     *
+     * @param item 만료 시 돌려받을 값
+     * @param ticks 현재 틱으로부터의 지연 (0은 다음 틱으로 취급)
+     */
+    void schedule(T item, uint64_t ticks)
+    {
+        if (ticks == 0)
+            ticks = 1;
+
+        const uint64_t slotCount = slots_.size();
+        size_t slot = static_cast<size_t>((current_ + ticks) % slotCount);
+        slots_[slot].push_back({move(item), (ticks - 1) / slotCount});
+    }
+
+    /**
+     * @brief 휠을 한 틱 전진시키고 만료된 타이머를 수집
+     *
+     * @param expired 만료된 값이 추가될 벡터
+     */
+    void advance(vector<T> &expired)
+    {
+        current_ = (current_ + 1) % slots_.size();
+        tick_++;
+
+        auto &entries = slots_[current_];
+        size_t i = 0;
+        while (i < entries.size())
+        {
+            if (entries[i].rounds == 0)
+            {
+                expired.push_back(move(entries[i].item));
+                entries[i] = move(entries.back());
+                entries.pop_back();
+            }
+            else
+            {
+                entries[i].rounds--;
+                i++;
+            }
+        }
+    }
+
+    /**
+     * @brief 휠 생성 이후 진행된 틱 수 반환
+     *
+     * @return uint64_t 누적 틱 수
+     */
+    uint64_t now() const { return tick_; }
+
+private:
+    /**
+     * @brief 슬롯에 저장되는 타이머 항목
+     */
+    struct Entry
+    {
+        T item;          ///< 만료 시 돌려줄 값
+        uint64_t rounds; ///< 만료까지 남은 휠 회전 수
+    };
+
+    vector<vector<Entry>> slots_; ///< 슬롯별 타이머 목록
+    size_t current_;              ///< 현재 슬롯 위치
+    uint64_t tick_;               ///< 누적 틱 수
+};
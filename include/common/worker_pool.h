@@ -0,0 +1,196 @@
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <future>
+#include <functional>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+using namespace std;
+
+/**
+ * @brief 작업 훔치기(work-stealing) 방식의 고정 크기 작업자 풀
+ *
+ * 작업자마다 자신의 작업 큐를 가지며, 자신의 큐가 비면 다른 작업자의 큐에서
+ * 작업을 가져와 실행한다. 작업자 스레드는 생성 시 한 번만 만들어지므로
+ * 정상 동작 중에는 스레드 생성 비용이 발생하지 않는다.
+ *
+ * 외부 스레드에서 제출한 작업(수집기 최상위 작업)은 별도의 주입 큐에 쌓이고,
+ * 작업자 스레드에서 제출한 하위 작업은 해당 작업자의 큐에 쌓인다.
+ * wait()로 대기하는 동안에는 대기 중인 작업이 직접 제출한 하위 작업만 실행하므로
+ * 풀 크기가 작아도 중첩 대기로 인한 교착이 없고, 다른 수집기의 작업을 떠맡지도 않는다.
+ * 무기한 멈출 수 있는 시스템 호출은 이 풀이 아니라 BlockingPool에서 실행한다.
+ */
+class WorkerPool
+{
+public:
+    /**
+     * @brief 작업자 풀 생성자
+     *
+     * @param threadCount 작업자 스레드 수 (0이면 defaultThreadCount() 사용)
+     */
+    explicit WorkerPool(size_t threadCount = 0);
+
+    /**
+     * @brief 작업자 풀 소멸자
+     *
+     * 대기 중인 작업은 폐기하고 모든 작업자 스레드를 종료한다
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    /**
+     * @brief 작업을 풀에 제출
+     *
+     * @tparam F 호출 가능한 작업 타입
+     * @param task 실행할 작업
+     * @return future 작업 결과를 받을 future 객체
+     */
+    template <typename F>
+    auto submit(F &&task) -> future<invoke_result_t<decay_t<F>>>
+    {
+        using Result = invoke_result_t<decay_t<F>>;
+        auto packaged = make_shared<packaged_task<Result()>>(forward<F>(task));
+        future<Result> result = packaged->get_future();
+        push([packaged]()
+             { (*packaged)(); });
+        return result;
+    }
+
+    /**
+     * @brief future가 완료될 때까지 대기
+     *
+     * 작업자 스레드에서 호출하면 대기하는 동안 현재 작업이 제출한 하위 작업 중
+     * 아직 다른 작업자가 가져가지 않은 것을 직접 실행한다
+     *
+     * @param result 대기할 future 객체
+     * @return T 작업 결과
+     */
+    template <typename T>
+    T wait(future<T> &result)
+    {
+        while (result.wait_for(chrono::seconds(0)) != future_status::ready)
+        {
+            if (!runLocalTask())
+            {
+                result.wait_for(chrono::milliseconds(1));
+            }
+        }
+        return result.get();
+    }
+
+    /**
+     * @brief 지정한 시간 동안 future의 완료를 대기
+     *
+     * 실행 시간을 미리 알 수 없는 작업을 직접 실행하면 제한 시간을 넘길 수 있으므로
+     * wait()와 달리 하위 작업을 대신 실행하지 않는다. 같은 풀의 작업자 스레드에서
+     * 이 풀의 작업을 기다리면 다른 작업자가 처리할 때까지 대기하게 된다.
+     *
+     * @param result 대기할 future 객체
+     * @param timeout 최대 대기 시간
+     * @return future_status 대기 종료 시점의 상태
+     */
+    template <typename T>
+    future_status waitFor(future<T> &result, chrono::milliseconds timeout)
+    {
+        return result.wait_for(timeout);
+    }
+
+    /**
+     * @brief 작업자 스레드 수 반환
+     *
+     * @return size_t 작업자 스레드 수
+     */
+    size_t size() const { return workers_.size(); }
+
+    /**
+     * @brief 아직 실행되지 않은 작업 수 반환
+     *
+     * @return size_t 대기 중인 작업 수
+     */
+    size_t pendingTasks() const { return pending_.load(); }
+
+    /**
+     * @brief 기본 작업자 스레드 수 반환
+     *
+     * 하드웨어 스레드 수와 4 중 작은 값 (최소 1)
+     *
+     * @return size_t 기본 작업자 스레드 수
+     */
+    static size_t defaultThreadCount();
+
+private:
+    /**
+     * @brief 큐에 쌓인 작업
+     */
+    struct Task
+    {
+        function<void()> run; ///< 실행할 함수
+        uint64_t id = 0;      ///< 작업 식별자 (1부터 증가)
+        uint64_t owner = 0;   ///< 이 작업을 제출한 작업의 식별자 (외부 제출이면 0)
+    };
+
+    /**
+     * @brief 작업 큐
+     */
+    struct WorkQueue
+    {
+        mutex queueMutex;  ///< 큐 접근 동기화를 위한 뮤텍스
+        deque<Task> tasks; ///< 대기 중인 작업 목록
+    };
+
+    vector<unique_ptr<WorkQueue>> queues_; ///< 작업자별 하위 작업 큐
+    WorkQueue injection_;                  ///< 외부 스레드에서 제출한 작업 큐
+    vector<thread> workers_;               ///< 작업자 스레드 목록
+    mutex sleepMutex_;                     ///< 유휴 대기용 뮤텍스
+    condition_variable wakeUp_;            ///< 새 작업 도착을 알리는 조건 변수
+    atomic<bool> stop_;                    ///< 종료 신호 플래그
+    atomic<size_t> pending_;               ///< 대기 중인 작업 수
+    atomic<uint64_t> nextTaskId_;          ///< 다음 작업 식별자
+
+    /**
+     * @brief 작업을 큐에 추가하고 유휴 작업자를 깨움
+     *
+     * @param task 추가할 작업
+     */
+    void push(function<void()> task);
+
+    /**
+     * @brief 작업자 스레드 메인 루프
+     *
+     * @param index 작업자 번호
+     */
+    void workerLoop(size_t index);
+
+    /**
+     * @brief 자신의 큐, 주입 큐, 다른 작업자의 큐 순서로 작업을 가져옴
+     *
+     * @param index 작업자 번호
+     * @param task 가져온 작업을 저장할 참조
+     * @return bool 작업을 가져왔으면 true
+     */
+    bool takeTask(size_t index, Task &task);
+
+    /**
+     * @brief 현재 작업 식별자를 설정한 채 작업을 실행
+     *
+     * @param task 실행할 작업
+     */
+    static void execute(Task &task);
+
+    /**
+     * @brief 현재 작업이 제출한 하위 작업 하나를 자신의 큐에서 꺼내 실행
+     *
+     * @return bool 작업을 실행했으면 true (작업자 스레드에서 실행 중인 작업이 아니면 항상 false)
+     */
+    bool runLocalTask();
+};
@@ -0,0 +1,171 @@
+/**
+ * @file collector_options.h
+ * @brief 수집기 관리자 실행 옵션 정의
+ * @author System Monitor Team
+ */
+
+#pragma once
+
+#include "common/bounded_queue.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <cstddef>
+#include <sys/types.h>
+
+using namespace std;
+
+/**
+ * @brief 상위 K개 프로세스를 고르는 기준
+ */
+enum class ProcessRank
+{
+    Cpu,    ///< CPU 사용률
+    Memory, ///< 상주 메모리(RSS)
+    Io      ///< 직전 주기 이후 읽기/쓰기 바이트 증가량
+};
+
+/**
+ * @brief 프로세스 수집기 옵션을 저장하는 구조체
+ */
+struct ProcessOptions
+{
+    /**
+     * @brief 내보낼 상위 프로세스 수 (0이면 전체)
+     *
+     * 0보다 크면 /proc 순회 중에 크기 K의 힙으로 상위 프로세스만 남기므로
+     * 정렬 비용과 전송량이 전체 프로세스 수가 아닌 K에 비례합니다.
+     */
+    size_t topK = 0;
+
+    /**
+     * @brief 상위 K개를 고르는 기준
+     */
+    ProcessRank rankBy = ProcessRank::Cpu;
+
+    /**
+     * @brief 순위와 관계없이 항상 포함할 프로세스 ID 목록
+     */
+    set<pid_t> includePids;
+
+    /**
+     * @brief 순위와 관계없이 항상 포함할 프로세스 이름 목록 (comm과 정확히 일치)
+     */
+    set<string, less<>> includeNames;
+
+    /**
+     * @brief 프로세스 트리별 합산 정보 생성 여부
+     */
+    bool groupTrees = false;
+
+    /**
+     * @brief cgroup별 합산 정보 생성 여부 (/proc/[pid]/cgroup을 추가로 읽음)
+     */
+    bool groupCgroups = false;
+
+    /**
+     * @brief 스레드별 CPU 사용량을 수집할 프로세스 ID 목록
+     */
+    set<pid_t> threadPids;
+
+    /**
+     * @brief 스레드별 CPU 사용량을 수집할 프로세스 이름 목록 (comm과 정확히 일치)
+     */
+    set<string, less<>> threadNames;
+
+    /**
+     * @brief netlink 프로세스 커넥터로 생명주기 이벤트 수신 여부 (CAP_NET_ADMIN이 없으면 폴링으로 동작)
+     */
+    bool processEvents = false;
+
+    /**
+     * @brief 수집 주기 사이에 보관할 최대 생명주기 이벤트 수
+     */
+    size_t eventCapacity = 1024;
+
+    /**
+     * @brief /proc/[pid]/io를 읽을 프로세스 수 (-1이면 전체, 0이면 읽지 않음, N이면 CPU 사용률 상위 N개)
+     *
+     * N을 지정해도 groupTrees나 groupCgroups를 켜면 합산 I/O를 위해 전체 프로세스를 읽습니다.
+     */
+    int ioLimit = -1;
+
+    /**
+     * @brief 열린 파일 수를 셀 프로세스 수 (-1이면 전체, 0이면 세지 않음, N이면 CPU 사용률 상위 N개)
+     */
+    int fdLimit = -1;
+};
+
+/**
+ * @brief 수집기 관리자 실행 옵션을 저장하는 구조체
+ *
+ * 명령행 인수로부터 채워지며 SystemClient를 거쳐 CollectorManager로 전달됩니다.
+ * 지정하지 않은 항목은 CollectorManager의 기본값을 사용합니다.
+ */
+struct CollectorOptions
+{
+    /**
+     * @brief 수집기별 수집 주기 재정의 (수집기 이름 → 초)
+     *
+     * 수집기 이름: cpu, memory, pressure, disk, network, process, system, docker, service
+     */
+    map<string, int> periods;
+
+    /**
+     * @brief 모든 수집기가 공유하는 작업자 풀의 스레드 수 (0이면 CPU 코어 수, 최대 4)
+     */
+    size_t workerThreads = 0;
+
+    /**
+     * @brief 발행 주기마다 수집 완료를 기다리는 최대 시간 (밀리초, 0이면 발행 주기의 절반과 1초 중 작은 값)
+     *
+     * 이 시간이 지나면 끝나지 않은 수집기의 섹션을 stale로 표시하고 스냅샷을 발행합니다.
+     */
+    int cycleDeadlineMs = 0;
+
+    /**
+     * @brief 호스트별 발행 시점 지터 최대값 (밀리초, 0이면 지터 없음)
+     *
+     * 발행 시점은 벽시계 기준 발행 주기 경계에 정렬되며, 지정하면 시스템 키로부터 정해지는
+     * 0 ~ jitterMs 범위의 고정 오프셋만큼 늦춰 여러 호스트의 전송이 한 순간에 몰리지 않게 합니다.
+     */
+    int jitterMs = 0;
+
+    /**
+     * @brief 수집 결과의 변화량에 따라 수집기별 주기를 조정할지 여부
+     *
+     * 결과가 바뀌지 않는 수집기(디스크 구성, 서비스 목록, 컨테이너 목록 등)는 기본 주기의 최대 8배까지
+     * 점차 늦추고, 값이 급변한 수집기(CPU 사용률 급등 등)는 기본 주기의 절반(최소 1초)으로 앞당깁니다.
+     * 늦춰진 동안에는 임계값 미만의 사용률 변화가 발행되지 않으므로 명시적으로 켤 때만 사용합니다.
+     */
+    bool adaptiveRate = false;
+
+    /**
+     * @brief 에이전트 프로세스의 CPU 사용률 예산 (%, 코어 하나 기준, 0이면 제한 없음)
+     *
+     * 발행 주기마다 getrusage로 측정한 사용률이 예산을 넘으면 모든 수집 주기를 비율만큼 늘리고,
+     * 예산 아래로 내려가면 다시 기본 주기로 되돌립니다.
+     */
+    double cpuBudgetPercent = 0.0;
+
+    /**
+     * @brief 실행할 수집기 이름 목록 (비어 있으면 모든 수집기 실행)
+     */
+    set<string> enabledCollectors;
+
+    /**
+     * @brief 실행하지 않을 수집기 이름 목록 (enabledCollectors보다 우선)
+     */
+    set<string> disabledCollectors;
+
+    /**
+     * @brief 메트릭/로그 파이프라인 큐 구현과 가득 찼을 때 동작
+     */
+    QueueOptions queue;
+
+    /**
+     * @brief 프로세스 수집기 옵션
+     */
+    ProcessOptions process;
+};
@@ -1,7 +1,8 @@
 #pragma once
 
 #include "log/log_type.h"
-#include "common/thread_safe_queue.h"
+#include "common/bounded_queue.h"
+#include "common/self_metrics.h"
 #include <spdlog/sinks/base_sink.h>
 #include <mutex>
 #include <string>
@@ -13,7 +14,7 @@ template <typename Mutex>
 class LogCaptureSink : public spdlog::sinks::base_sink<Mutex>
 {
 public:
-    LogCaptureSink(ThreadSafeQueue<LogType> &queue, const string &nodeId)
+    LogCaptureSink(BoundedQueue<LogType> &queue, const string &nodeId)
         : queue_(queue), nodeId_(nodeId) {}
 
 protected:
@@ -60,13 +61,17 @@ protected:
         logData.content = fullContent;
 
         // 큐에 추가 (예외 처리 추가)
+        // 가득 찬 경우 큐의 드롭 정책을 따르므로 로그를 남기는 스레드가 대기하지 않음
         try
         {
-            bool success = queue_.push(logData);
-            if (!success)
+            queue_.push(move(logData));
+
+            // 드롭이 발생했을 때만 자체 지표 갱신 (로그 전송기가 멈춘 동안에도 드롭 수가 보이도록)
+            uint64_t dropped = queue_.dropped();
+            if (dropped != lastDropped_)
             {
-                // fprintf로 직접 출력 (로그 루프 방지용)
-                fprintf(stderr, "로그 큐 추가 실패: %s\n", logData.content.c_str());
+                lastDropped_ = dropped;
+                SelfMetrics::instance().setQueueState(SelfMetrics::Queue::Logs, queue_.size(), dropped);
             }
         }
         catch (const exception &e)
@@ -78,8 +83,9 @@ protected:
     void flush_() override {}
 
 private:
-    ThreadSafeQueue<LogType> &queue_;
+    BoundedQueue<LogType> &queue_;
     string nodeId_;
+    uint64_t lastDropped_ = 0; // 마지막으로 기록한 드롭 수 (싱크 뮤텍스로 보호)
 };
 
 using LogCaptureSinkMt = LogCaptureSink<mutex>;
\ No newline at end of file
@@ -46,8 +46,10 @@ public:
      * @param serverInfo 원격 로깅 서버 정보
      * @param nodeId 노드 식별자
      * @param intervalSeconds 로그 전송 간격 (초)
+     * @param queueOptions 로그 큐 구현과 가득 찼을 때 동작
      */
-    static void initWithRemoteLogging(const ServerInfo &serverInfo, const string &nodeId, int intervalSeconds);
+    static void initWithRemoteLogging(const ServerInfo &serverInfo, const string &nodeId, int intervalSeconds,
+                                      const QueueOptions &queueOptions = QueueOptions());
 
 private:
     /**
@@ -59,9 +61,9 @@ private:
      */
     static unique_ptr<LogSender> s_logSender;
     /**
-     * @brief 로그 큐
+     * @brief 로그 큐 (원격 로깅 초기화 시 생성)
      */
-    static ThreadSafeQueue<LogType> s_logQueue;
+    static unique_ptr<BoundedQueue<LogType>> s_logQueue;
     /**
      * @brief 원격 로깅 활성화 여부
      */
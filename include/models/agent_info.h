@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief 수집기 하나의 실행 통계를 저장하는 구조체
+ *
+ * 에이전트 자체 계측 레지스트리(SelfMetrics)에서 스냅샷 시점에 채워집니다.
+ */
+struct CollectorStats
+{
+    /** @brief 수집기 이름 (예: cpu, docker) */
+    string name;
+
+    /** @brief 누적 실행 횟수 */
+    uint64_t runs = 0;
+
+    /** @brief 누적 오류 횟수 (수집 중 예외 발생) */
+    uint64_t errors = 0;
+
+    /** @brief 마지막 실행 소요 시간 (밀리초) */
+    double last_ms = 0.0;
+
+    /** @brief 평균 실행 소요 시간 (밀리초) */
+    double avg_ms = 0.0;
+
+    /** @brief 최대 실행 소요 시간 (밀리초) */
+    double max_ms = 0.0;
+
+    /** @brief 히스토그램으로 추정한 95 백분위 소요 시간 상한 (밀리초) */
+    double p95_ms = 0.0;
+
+    /** @brief 수집 스레드에서 소비한 누적 CPU 시간 (밀리초) */
+    double cpu_ms = 0.0;
+
+    /** @brief 변화량과 CPU 예산에 따라 조정되어 현재 적용 중인 수집 주기 (밀리초) */
+    uint64_t period_ms = 0;
+
+    /** @brief 소요 시간 히스토그램 (i번째 칸: 2^(i-1)ms 이상 2^i ms 미만, 0번 칸: 1ms 미만, 마지막 칸: 그 이상) */
+    vector<uint64_t> latency_histogram;
+};
+
+/**
+ * @brief 내부 큐 하나의 상태를 저장하는 구조체
+ */
+struct QueueStats
+{
+    /** @brief 큐 이름 (예: metrics, logs) */
+    string name;
+
+    /** @brief 마지막으로 관측한 큐 깊이 */
+    uint64_t depth = 0;
+
+    /** @brief 큐가 가득 차서 버려지거나 대체된 누적 아이템 수 */
+    uint64_t dropped = 0;
+};
+
+/**
+ * @brief 모니터링 에이전트 자체의 동작 지표를 저장하는 구조체
+ *
+ * 수집기별 소요 시간과 오류, 직렬화한 데이터 양, 내부 큐 깊이 등을 포함하며
+ * 어떤 수집기가 에이전트의 CPU 예산을 소비하는지 파악하는 데 사용됩니다.
+ */
+struct AgentInfo
+{
+    /** @brief 에이전트 프로세스의 누적 CPU 시간 (사용자 + 커널, 밀리초) */
+    double cpu_time_ms = 0.0;
+
+    /** @brief 전송을 위해 직렬화한 누적 바이트 수 */
+    uint64_t bytes_serialized = 0;
+
+    /** @brief 직렬화한 누적 스냅샷 수 */
+    uint64_t snapshots_serialized = 0;
+
+    /** @brief 스케줄러가 제때 처리하지 못하고 건너뛴 누적 틱 수 */
+    uint64_t tick_overruns = 0;
+
+    /** @brief 발행 시점을 놓쳐 건너뛴 누적 발행 주기 수 */
+    uint64_t missed_cycles = 0;
+
+    /** @brief CPU 예산 초과로 모든 수집 주기에 곱해지는 배율 (1.0이면 예산 이내) */
+    double rate_scale = 1.0;
+
+    /** @brief 수집기별 실행 통계 */
+    vector<CollectorStats> collectors;
+
+    /** @brief 내부 큐 상태 */
+    vector<QueueStats> queues;
+};
@@ -11,6 +11,26 @@
 
 using namespace std;
 
+/**
+ * @struct CpuTimes
+ * @brief 직전 수집 이후 CPU 시간의 항목별 비율 (/proc/stat 기준, 백분율)
+ *
+ * user부터 steal까지의 합이 100이며, guest와 guest_nice는 각각 user와 nice에 이미 포함된 값입니다.
+ */
+struct CpuTimes
+{
+    float user = 0.0f;       ///< 사용자 모드
+    float nice = 0.0f;       ///< 낮은 우선순위 사용자 모드
+    float system = 0.0f;     ///< 커널 모드
+    float idle = 0.0f;       ///< 유휴
+    float iowait = 0.0f;     ///< I/O 완료 대기 중 유휴
+    float irq = 0.0f;        ///< 하드웨어 인터럽트 처리
+    float softirq = 0.0f;    ///< 소프트웨어 인터럽트 처리
+    float steal = 0.0f;      ///< 하이퍼바이저가 다른 가상 머신에 준 시간
+    float guest = 0.0f;      ///< 게스트 가상 머신 실행 (user에 포함)
+    float guest_nice = 0.0f; ///< 낮은 우선순위 게스트 가상 머신 실행 (nice에 포함)
+};
+
 /**
  * @struct CpuCoreInfo
  * @brief CPU 코어에 대한 정보를 저장하는 구조체
@@ -18,8 +38,10 @@ using namespace std;
 struct CpuCoreInfo
 {
     size_t id;         ///< 코어 식별자
-    float usage;       ///< 코어 사용률 (백분율)
+    float usage;       ///< 코어 사용률 (백분율, idle과 iowait를 제외한 비율)
     float temperature; ///< 코어 온도 (섭씨)
+    float speed;       ///< 현재 클럭 속도 (MHz, cpufreq scaling_cur_freq, 알 수 없으면 0)
+    CpuTimes times;    ///< 코어 CPU 시간 항목별 비율
 };
 
 /**
@@ -31,7 +53,8 @@ struct CpuInfo
     string model;               ///< CPU 모델명
     string vendor;              ///< CPU 제조사
     string architecture;        ///< CPU 아키텍처 (x86, x86_64, ARM 등)
-    float usage;                ///< 전체 CPU 사용률 (백분율)
+    float usage;                ///< 전체 CPU 사용률 (백분율, idle과 iowait를 제외한 비율)
+    CpuTimes times;             ///< 전체 CPU 시간 항목별 비율
     float temperature;          ///< 전체 CPU 온도 (섭씨)
     size_t total_cores;         ///< 물리적 코어 총 개수
     size_t total_logical_cores; ///< 논리적 코어 총 개수
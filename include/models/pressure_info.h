@@ -0,0 +1,62 @@
+/**
+ * @file pressure_info.h
+ * @brief 자원 압력(PSI)과 CPU 실행 대기 정보를 저장하는 구조체 정의
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief PSI 한 줄(some 또는 full)의 값
+ *
+ * some은 하나 이상의 작업이, full은 유휴가 아닌 모든 작업이 해당 자원을 기다리며 멈춘 시간입니다.
+ */
+struct PressureStat
+{
+    float avg10 = 0.0f;         ///< 최근 10초 동안 멈춘 시간 비율 (%)
+    float avg60 = 0.0f;         ///< 최근 60초 동안 멈춘 시간 비율 (%)
+    float avg300 = 0.0f;        ///< 최근 300초 동안 멈춘 시간 비율 (%)
+    uint64_t total = 0;         ///< 부팅 이후 누적 멈춘 시간 (마이크로초)
+    uint64_t delta = 0;         ///< 직전 수집 이후 멈춘 시간 (마이크로초)
+    float stall_percent = 0.0f; ///< 직전 수집 이후 경과 시간 대비 멈춘 시간 비율 (%)
+};
+
+/**
+ * @brief 자원 하나(/proc/pressure/cpu, memory, io)의 압력 정보
+ */
+struct ResourcePressure
+{
+    PressureStat some; ///< 일부 작업이 멈춘 시간
+    PressureStat full; ///< 모든 작업이 멈춘 시간 (5.13 이전 커널의 cpu에는 없어 0)
+};
+
+/**
+ * @brief /proc/schedstat의 CPU 하나에 대한 실행/대기 시간
+ */
+struct SchedCoreInfo
+{
+    size_t id = 0;           ///< 코어 식별자 (/proc/schedstat의 cpuN)
+    uint64_t run_time = 0;   ///< 직전 수집 이후 작업이 실행된 시간 (나노초)
+    uint64_t wait_time = 0;  ///< 직전 수집 이후 작업이 실행 큐에서 기다린 시간 합계 (나노초)
+    uint64_t timeslices = 0; ///< 직전 수집 이후 실행된 타임슬라이스 수
+    float wait_ratio = 0.0f; ///< 경과 시간 대비 대기 시간 (실행 큐에서 기다린 평균 작업 수)
+};
+
+/**
+ * @brief 자원 압력과 스케줄러 실행 대기 정보
+ *
+ * CPU 사용률만으로는 알 수 없는 포화(작업이 실제로 자원을 기다리며 멈추는지) 여부를 나타냅니다.
+ */
+struct PressureInfo
+{
+    bool available = false;      ///< PSI를 읽을 수 있는지 여부 (CONFIG_PSI가 없거나 psi=0이면 false)
+    ResourcePressure cpu;        ///< CPU 압력
+    ResourcePressure memory;     ///< 메모리 압력
+    ResourcePressure io;         ///< I/O 압력
+    vector<SchedCoreInfo> cores; ///< 코어별 실행 대기 정보 (CONFIG_SCHEDSTATS가 없으면 비어 있음)
+};
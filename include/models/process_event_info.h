@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <ctime>
+#include <sys/types.h>
+
+using namespace std;
+
+/**
+ * @brief 프로세스 생명주기 이벤트(생성, 실행, 종료) 하나의 정보를 저장하는 구조체
+ *
+ * netlink 프로세스 커넥터로 수신하며, 폴링 사이에 시작하고 끝난 짧은 프로세스도 기록됩니다.
+ */
+struct ProcessEventInfo
+{
+    /** @brief 이벤트 종류 ("fork", "exec", "exit") */
+    string type;
+
+    /** @brief 이벤트 수신 시각 (타임스탬프) */
+    time_t time = 0;
+
+    /** @brief 프로세스 식별자 */
+    pid_t pid = 0;
+
+    /** @brief 부모 프로세스 식별자 (fork 이벤트만, 그 외에는 0) */
+    pid_t ppid = 0;
+
+    /** @brief 프로세스 이름 (exec 시점에 읽은 comm, 알 수 없으면 빈 문자열) */
+    string name;
+
+    /** @brief 종료 코드 (exit 이벤트에서 정상 종료한 경우, 그 외에는 -1) */
+    int exit_code = -1;
+
+    /** @brief 종료 시그널 번호 (exit 이벤트에서 시그널로 종료된 경우, 그 외에는 0) */
+    int exit_signal = 0;
+
+    /** @brief 실행 시간 (초, exit 이벤트에서 생성 시점을 관측한 경우, 그 외에는 -1) */
+    double runtime = -1.0;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <sys/types.h>
+
+using namespace std;
+
+/**
+ * @brief 프로세스 트리 또는 cgroup 단위로 합산한 자원 사용량 정보를 저장하는 구조체
+ *
+ * 컨테이너가 많은 호스트에서 수천 개의 개별 프로세스 대신
+ * 수백 개의 그룹만 전송할 수 있도록 하위 프로세스의 사용량을 합산합니다.
+ */
+struct ProcessGroupInfo
+{
+    /** @brief 그룹 식별자 (트리: 루트 프로세스 ID, cgroup: cgroup 경로) */
+    string id;
+
+    /** @brief 그룹 이름 (트리: 루트 프로세스 이름, cgroup: 경로의 마지막 구성 요소) */
+    string name;
+
+    /** @brief 그룹에 속한 프로세스 수 */
+    int process_count = 0;
+
+    /** @brief 그룹에 속한 프로세스들의 스레드 수 합계 */
+    int threads = 0;
+
+    /** @brief 그룹에 속한 프로세스들의 CPU 사용률 합계 (%) */
+    float cpu_usage = 0.0f;
+
+    /** @brief 그룹에 속한 프로세스들의 상주 메모리 합계 (바이트) */
+    uint64_t memory_rss = 0;
+
+    /** @brief 그룹에 속한 프로세스들의 읽은 I/O 바이트 합계 */
+    uint64_t io_read_bytes = 0;
+
+    /** @brief 그룹에 속한 프로세스들의 쓴 I/O 바이트 합계 */
+    uint64_t io_write_bytes = 0;
+};
@@ -1,13 +1,45 @@
 #pragma once
 #include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
 
 using namespace std;
 
+/**
+ * @brief 프로세스에 속한 스레드(태스크) 하나의 정보를 저장하는 구조체
+ *
+ * 스레드 단위 수집 대상으로 지정한 프로세스에만 채워집니다.
+ */
+struct ThreadInfo
+{
+    /** @brief 스레드 식별자 (Thread ID) */
+    pid_t tid;
+
+    /** @brief 스레드 이름 (comm, 값이 제한되지 않으므로 인터닝하지 않음) */
+    string name;
+
+    /** @brief 스레드 상태 (실행 중, 대기, 중지 등, 정적 문자열 또는 인터닝된 문자열) */
+    string_view status;
+
+    /** @brief 전체 머신 대비 CPU 사용률 (%) */
+    float cpu_usage;
+
+    /** @brief 코어 하나 대비 CPU 사용률 (%) */
+    float cpu_core_usage;
+
+    /** @brief 누적 CPU 사용 시간 (초 단위) */
+    float cpu_time;
+};
+
 /**
  * @brief 시스템에서 실행 중인 프로세스의 상세 정보를 저장하는 구조체
  *
  * 이 구조체는 프로세스 모니터링에 필요한 모든 핵심 정보를 포함합니다.
  * CPU 사용량, 메모리 사용량, I/O 활동 및 기타 프로세스 관련 정보를 추적합니다.
+ * 값의 종류가 적은 사용자와 상태는 StringPool에 인터닝된 string_view로 보관하므로
+ * 주기마다 목록을 복사해도 문자열 할당이 발생하지 않습니다. 이름은 값이 제한되지 않아
+ * 인터닝하지 않지만 comm은 15자 이하라 복사 시 할당이 없습니다.
  */
 struct ProcessInfo
 {
@@ -17,15 +49,18 @@ struct ProcessInfo
     /** @brief 부모 프로세스 식별자 (Parent Process ID) */
     pid_t ppid;
 
-    /** @brief 프로세스 이름 */
+    /** @brief 프로세스 이름 (comm, 15자 이하라 복사해도 할당이 없음) */
     string name;
 
-    /** @brief 프로세스 상태 (실행 중, 대기, 중지 등) */
-    string status;
+    /** @brief 프로세스 상태 (실행 중, 대기, 중지 등, 정적 문자열 또는 인터닝된 문자열) */
+    string_view status;
 
-    /** @brief CPU 사용률 (%) */
+    /** @brief 전체 머신 대비 CPU 사용률 (%, 모든 온라인 CPU를 합친 용량 기준) */
     float cpu_usage;
 
+    /** @brief 코어 하나 대비 CPU 사용률 (%, 여러 코어를 쓰면 100을 넘음) */
+    float cpu_core_usage;
+
     /** @brief 실제 물리 메모리 사용량 (Resident Set Size, KB 단위) */
     uint64_t memory_rss;
 
@@ -35,8 +70,8 @@ struct ProcessInfo
     /** @brief 프로세스의 스레드 개수 */
     int threads;
 
-    /** @brief 프로세스를 실행한 사용자 이름 */
-    string user;
+    /** @brief 프로세스를 실행한 사용자 이름 (StringPool에 인터닝된 문자열) */
+    string_view user;
 
     /** @brief 프로세스 실행 명령어 및 매개변수 */
     string command;
@@ -58,4 +93,7 @@ struct ProcessInfo
 
     /** @brief 프로세스 우선순위 값 (-20에서 19 사이, 낮을수록 우선순위 높음) */
     long nice;
+
+    /** @brief 스레드별 정보 (스레드 단위 수집 대상 프로세스만 채워지며, 그 외에는 비어 있음) */
+    vector<ThreadInfo> thread_details;
 };
\ No newline at end of file
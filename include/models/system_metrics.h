@@ -11,12 +11,16 @@
 
 #include "models/cpu_info.h"
 #include "models/memory_info.h"
+#include "models/pressure_info.h"
 #include "models/disk_info.h"
 #include "models/network_interface.h"
 #include "models/process_info.h"
+#include "models/process_group_info.h"
+#include "models/process_event_info.h"
 #include "models/docker_container_info.h"
 #include "models/system_info.h"
 #include "models/service_info.h"
+#include "models/agent_info.h"
 
 using namespace std;
 
@@ -59,6 +63,11 @@ struct SystemMetrics
      */
     MemoryInfo memory;
 
+    /**
+     * @brief 자원 압력(PSI)과 코어별 실행 대기 정보
+     */
+    PressureInfo pressure;
+
     /**
      * @brief 디스크 정보 목록
      */
@@ -74,6 +83,21 @@ struct SystemMetrics
      */
     vector<ProcessInfo> process;
 
+    /**
+     * @brief 프로세스 트리(PID 1의 자식 또는 부모가 없는 프로세스를 루트로 하는 하위 트리)별 합산 정보 목록
+     */
+    vector<ProcessGroupInfo> process_trees;
+
+    /**
+     * @brief cgroup별 프로세스 합산 정보 목록
+     */
+    vector<ProcessGroupInfo> cgroups;
+
+    /**
+     * @brief 직전 프로세스 수집 이후 수신한 프로세스 생명주기 이벤트 목록
+     */
+    vector<ProcessEventInfo> process_events;
+
     /**
      * @brief 도커 컨테이너 정보 목록
      */
@@ -83,4 +107,16 @@ struct SystemMetrics
      * @brief 시스템 서비스 정보 목록
      */
     vector<ServiceInfo> services;
+
+    /**
+     * @brief 이번 발행 주기 내에 갱신되지 못한 섹션 이름 목록
+     *
+     * 해당 섹션은 마지막으로 완료된 수집 결과(또는 빈 값)를 담고 있습니다.
+     */
+    vector<string> stale_sections;
+
+    /**
+     * @brief 모니터링 에이전트 자체 동작 지표
+     */
+    AgentInfo agent;
 };
\ No newline at end of file
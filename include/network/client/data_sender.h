@@ -38,8 +38,10 @@ public:
      * @param serverInfo 연결할 서버 정보 (주소, 포트 등)
      * @param dataQueue 전송할 시스템 메트릭 데이터가 저장된 스레드 안전 큐
      * @param user_id 사용자 식별자
+     * @param recycleQueue 전송을 마친 메트릭을 돌려보낼 재사용 큐 (nullptr이면 돌려보내지 않음)
      */
-    DataSender(const ServerInfo &serverInfo, ThreadSafeQueue<SystemMetrics> &dataQueue, const string &user_id);
+    DataSender(const ServerInfo &serverInfo, BoundedQueue<SystemMetrics> &dataQueue, const string &user_id,
+               BoundedQueue<SystemMetrics> *recycleQueue = nullptr);
 
     /**
      * @brief DataSender 클래스 소멸자
@@ -87,7 +89,8 @@ private:
     typedef websocketpp::connection_hdl WebsocketHandle;
 
     ServerInfo serverInfo_;                     ///< 서버 연결 정보
-    ThreadSafeQueue<SystemMetrics> &dataQueue_; ///< 전송할 메트릭 데이터 큐
+    BoundedQueue<SystemMetrics> &dataQueue_;    ///< 전송할 메트릭 데이터 큐
+    BoundedQueue<SystemMetrics> *recycleQueue_; ///< 전송을 마친 메트릭을 돌려보낼 재사용 큐
     ThreadSafeQueue<CommandResult> commandResultQueue_; ///< 커맨드 처리 결과 큐
     ThreadSafeQueue<CommandResult> commandQueue_; ///< 처리할 커맨드 작업 큐
     string user_id_;                            ///< 사용자 식별자
@@ -2,7 +2,7 @@
 
 #include "network/common/network_types.h"
 #include "log/log_type.h"
-#include "common/thread_safe_queue.h"
+#include "common/bounded_queue.h"
 #include <websocketpp/client.hpp>
 #include <websocketpp/config/asio_no_tls_client.hpp>
 #include <thread>
@@ -14,7 +14,7 @@ using namespace std;
 class LogSender
 {
 public:
-    LogSender(const ServerInfo &serverInfo, ThreadSafeQueue<LogType> &logQueue);
+    LogSender(const ServerInfo &serverInfo, BoundedQueue<LogType> &logQueue);
     ~LogSender();
 
     bool connect();
@@ -28,7 +28,7 @@ private:
     typedef websocketpp::connection_hdl WebsocketHandle;
 
     ServerInfo serverInfo_;
-    ThreadSafeQueue<LogType> &logQueue_;
+    BoundedQueue<LogType> &logQueue_;
     WebsocketClient client_;
     WebsocketHandle connectionHandle_;
     atomic<bool> isConnected_;
@@ -8,6 +8,7 @@
 
 #include "network/common/network_types.h"
 #include "models/system_metrics.h"
+#include "config/collector_options.h"
 
 #include <string>
 #include <memory>
@@ -37,9 +38,11 @@ public:
      * @param collectionInterval 데이터 수집 간격 (초 단위, 기본값: 5초)
      * @param sendingInterval 데이터 전송 간격 (초 단위, 기본값: 5초)
      * @param user_id 사용자 식별자 (기본값: 빈 문자열)
+     * @param collectorOptions 수집기 실행 옵션 (기본값: 기본 설정)
      */
     SystemClient(const ServerInfo &serverInfo, const string &systemKey,
-                 int collectionInterval = 5, int sendingInterval = 5, const string &user_id = "");
+                 int collectionInterval = 5, int sendingInterval = 5, const string &user_id = "",
+                 const CollectorOptions &collectorOptions = CollectorOptions());
 
     /**
      * @brief SystemClient 클래스의 소멸자
@@ -85,6 +88,11 @@ private:
      */
     string user_id_;
 
+    /**
+     * @brief 수집기 실행 옵션
+     */
+    CollectorOptions collectorOptions_;
+
     /**
      * @brief 시스템 메트릭 수집 관리자
      */
@@ -164,6 +164,12 @@ private:
      */
     void updateDocker();
 
+    /**
+     * @brief 에이전트 자체 지표 화면 업데이트 함수
+     * @details 수집기별 소요 시간, 오류 수, 내부 큐 깊이 화면 갱신
+     */
+    void updateAgent();
+
     /**
      * @brief 구분선 생성 함수
      * @param title 구분선 중앙에 표시할 제목 (기본값: 빈 문자열)
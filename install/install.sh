@@ -59,7 +59,6 @@ install_dependencies() {
                         libsensors5 \
                         libncursesw6 \
                         libcurl4 \
-                        libprocps8 \
                         libssl3 \
                         libspdlog1 \
                         libsystemd0 \
@@ -70,7 +69,6 @@ install_dependencies() {
                         libsensors5 \
                         libncursesw6 \
                         libcurl4 \
-                        libproc2-0 \
                         libssl3t64 \
                         libspdlog1.12 \
                         libsystemd0 \
@@ -81,7 +79,6 @@ install_dependencies() {
                         libsensors5 \
                         libncursesw6 \
                         libcurl4 \
-                        libprocps8 \
                         libssl1.1 \
                         libspdlog1 \
                         libsystemd0 \
@@ -97,14 +94,14 @@ install_dependencies() {
             if [ "$OS" = "centos" ] && [ "$VERSION_ID" -lt 8 ]; then
                 yum install -y epel-release || return 1
                 yum install -y curl libcurl-devel openssl-devel libstatgrab-devel \
-                              lm_sensors-devel ncurses-devel procps-ng-devel jsoncpp-devel \
+                              lm_sensors-devel ncurses-devel jsoncpp-devel \
                               systemd-devel || return 1
             else
                 # CentOS 8+, Rocky, RHEL 8+
                 dnf install -y epel-release || return 1
                 dnf install -y curl libcurl-devel openssl-devel spdlog-devel \
                              nlohmann-json-devel libstatgrab-devel lm_sensors-devel \
-                             ncurses-devel procps-ng-devel jsoncpp-devel systemd-devel || return 1
+                             ncurses-devel jsoncpp-devel systemd-devel || return 1
             fi
             ;;
         *)
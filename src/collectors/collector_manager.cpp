@@ -1,7 +1,10 @@
 #include "collectors/collector_manager.h"
 #include <algorithm>
-#include <iostream>
+#include <cmath>
 #include <map>
+#include <type_traits>
+#include <unistd.h>
+#include "common/self_metrics.h"
 #include "log/logger.h"
 
 using namespace std;
@@ -16,11 +19,16 @@ extern atomic<bool> running; // extern으로 선언 (참조 기호 & 제거)
  * @brief CollectorManager 생성자
  *
  * @param systemKey 시스템 식별을 위한 고유 키 값
+ * @param options 수집기별 주기 등 실행 옵션
  * @param queueSize 수집된 데이터를 저장할 큐의 최대 크기 (기본값: 50)
  */
-CollectorManager::CollectorManager(const string &systemKey, size_t queueSize)
-    : systemKey_(systemKey), dataQueue_(queueSize)
+CollectorManager::CollectorManager(const string &systemKey, const CollectorOptions &options, size_t queueSize)
+    : workerPool_(options.workerThreads), systemKey_(systemKey),
+      dataQueue_(makeBoundedQueue<SystemMetrics>(queueSize, options.queue)),
+      recycleQueue_(makeBoundedQueue<SystemMetrics>(queueSize, {options.queue.kind, OverflowPolicy::Block})),
+      options_(options), timerWheel_(1024)
 {
+    LOG_INFO("수집 작업자 풀 스레드 수: {}", workerPool_.size());
 }
 
 /**
@@ -33,16 +41,6 @@ CollectorManager::~CollectorManager()
     stop();
 }
 
-/**
- * @brief 시스템 데이터 수집 작업 시작
- *
- * @param intervalSeconds 데이터 수집 주기(초 단위, 기본값: 5)
- */
-void CollectorManager::start(int intervalSeconds)
-{
-    collectionThread_ = thread(&CollectorManager::collectLoop, this, intervalSeconds);
-}
-
 /**
  * @brief 시스템 데이터 수집 작업 중지
  *
@@ -57,395 +55,810 @@ void CollectorManager::stop()
     }
 
     // 남은 작업들 정리
-    for (auto &task : collectorTasks_)
+    for (auto &schedule : schedules_)
     {
-        if (task.valid())
+        if (schedule->inFlight.valid())
         {
-            task.wait();
+            schedule->inFlight.wait();
         }
     }
-    collectorTasks_.clear();
 }
 
 /**
- * @brief 주기적인 데이터 수집 루프 실행 함수
+ * @brief 수집기 활성화 여부를 확인하는 함수
  *
- * @param intervalSeconds 수집 주기(초 단위)
+ * @param name 수집기 이름
+ * @return bool CollectorOptions의 활성화/비활성화 목록에 따라 실행해야 하면 true
  *
- * 지정된 주기마다 데이터를 수집하고, 수집 시간을 고려하여 다음 수집 시간을 조정합니다.
+ * 활성화 목록이 비어 있으면 모든 수집기가 대상이며, 비활성화 목록이 우선합니다.
  */
-void CollectorManager::collectLoop(int intervalSeconds)
+bool CollectorManager::isCollectorEnabled(const string &name) const
 {
-    while (running.load())
+    if (!options_.enabledCollectors.empty() && options_.enabledCollectors.count(name) == 0)
     {
-        auto startTime = chrono::steady_clock::now();
-
-        // 병렬로 데이터 수집
-        collectDataParallel();
+        return false;
+    }
+    return options_.disabledCollectors.count(name) == 0;
+}
 
-        // 다음 실행 시간 계산
-        auto endTime = chrono::steady_clock::now();
-        auto elapsed = chrono::duration_cast<chrono::milliseconds>(endTime - startTime);
-        auto sleepTime = chrono::seconds(intervalSeconds) - elapsed;
+/**
+ * @brief 주기를 타이머 휠 틱 수로 변환하는 함수
+ *
+ * @param period 변환할 주기
+ * @return uint64_t 틱 수 (최소 1)
+ */
+uint64_t CollectorManager::toTicks(chrono::milliseconds period)
+{
+    auto ticks = period.count() / TICK_INTERVAL.count();
+    return ticks > 0 ? static_cast<uint64_t>(ticks) : 1;
+}
 
-        if (sleepTime > chrono::milliseconds(0))
-        {
-            this_thread::sleep_for(sleepTime);
-        }
+/**
+ * @brief 현재 시각 이후 가장 가까운 벽시계 주기 경계를 계산
+ *
+ * @param period 주기
+ * @return chrono::system_clock::time_point 에포크 기준 period의 배수에 호스트 지터를 더한 시각 중
+ *         현재 시각보다 늦은 가장 이른 시각
+ *
+ * 같은 주기를 사용하는 호스트들은 지터가 없으면 모두 같은 시각을 얻으므로
+ * 서버에서 보간 없이 같은 초의 샘플끼리 집계할 수 있습니다.
+ */
+chrono::system_clock::time_point CollectorManager::nextBoundary(chrono::milliseconds period) const
+{
+    const int64_t periodMs = max<int64_t>(1, period.count());
+    const int64_t offsetMs = jitter_.count() % periodMs;
+    const int64_t nowMs = chrono::duration_cast<chrono::milliseconds>(
+                              chrono::system_clock::now().time_since_epoch())
+                              .count();
+
+    int64_t phase = (nowMs - offsetMs) % periodMs;
+    if (phase < 0)
+    {
+        phase += periodMs;
     }
+    return chrono::system_clock::time_point(chrono::milliseconds(nowMs - phase + periodMs));
 }
 
 /**
- * @brief 단일 수집기의 작업을 생성하는 템플릿 함수
+ * @brief 벽시계 시각을 같은 순간의 steady_clock 시각으로 변환
  *
- * @tparam Collector 수집기 타입
- * @param collector 수집기 인스턴스 참조
- * @param metrics 수집된 데이터를 저장할 메트릭 객체
- * @param metricsMutex 메트릭 객체 접근을 동기화할 뮤텍스
- * @return function<void()> 수집 작업 함수 객체
+ * @param wallTime 변환할 벽시계 시각
+ * @return chrono::steady_clock::time_point 대응하는 steady_clock 시각
  *
- * 기본 구현은 수집만 수행하고 메트릭에 저장하지 않습니다.
- * 구체적인 수집기 타입에 대한 특수화를 통해 구현됩니다.
+ * 대기는 벽시계 변경의 영향을 받지 않도록 steady_clock 기준 절대 시각으로 수행합니다.
  */
-template <typename Collector>
-function<void()> CollectorManager::createCollectorTask(
-    Collector &collector,
-    SystemMetrics &metrics,
-    mutex &metricsMutex)
+chrono::steady_clock::time_point CollectorManager::toSteady(chrono::system_clock::time_point wallTime)
 {
-    // 기본 구현 - 어떤 수집기인지 알 수 없으므로 단순히 수집만 수행
-    return [&collector]()
-    {
-        collector.collect();
-    };
+    auto remaining = chrono::duration_cast<chrono::steady_clock::duration>(wallTime - chrono::system_clock::now());
+    return chrono::steady_clock::now() + remaining;
 }
 
 /**
- * @brief CPU 수집기에 대한 특수화된 작업 생성 함수
+ * @brief 주기적인 데이터 수집 루프 실행 함수
  *
- * @param collector CPU 수집기 인스턴스
- * @param metrics 시스템 메트릭 객체
- * @param metricsMutex 메트릭 접근 동기화를 위한 뮤텍스
- * @return function<void()> CPU 정보 수집 작업 함수
+ * @param intervalSeconds 스냅샷 발행 주기(초 단위)
  *
- * CPU 사용량을 수집하고 메트릭 객체에 저장합니다.
+ * 시작 시 모든 수집기를 한 번 실행한 뒤, 각 수집기의 다음 실행이 자신의 주기에 맞는
+ * 벽시계 경계에 오도록 타이머 휠에 등록하고, 매 틱마다 주기가 도래한 수집기만 실행합니다.
+ * 틱은 벽시계 100ms 경계에 정렬된 steady_clock 절대 시각으로 예약되므로 처리 시간만큼
+ * 주기가 늘어나지 않습니다. 처리가 늦어 틱을 놓치면 놓친 틱을 한 번에 전진시키고
+ * 건너뛴 틱 수를 자체 지표에 기록합니다. 실행한 수집기의 다음 예약은 adaptPeriod()로 계산한
+ * 조정 주기를 사용합니다.
+ *
+ * 발행 주기의 벽시계 경계가 되면 그 이전에 시작된 수집이 끝나기를 주기별 허용 시간까지만 기다린 뒤
+ * 각 수집기의 최신 결과로 스냅샷을 만들어 큐에 추가하며, 타임스탬프는 경계 시각을 사용합니다.
+ * 허용 시간 내에 끝나지 않은 수집은 백그라운드에서 계속 실행되어 다음 스냅샷에 반영됩니다.
+ * 발행 주기마다 에이전트 CPU 사용률을 확인해 CPU 예산에 따른 주기 배율을 갱신합니다.
  */
-template <>
-function<void()> CollectorManager::createCollectorTask<CPUCollector>(
-    CPUCollector &collector,
-    SystemMetrics &metrics,
-    mutex &metricsMutex)
+void CollectorManager::collectLoop(int intervalSeconds)
 {
-    return [&collector, &metrics, &metricsMutex]()
+    const chrono::milliseconds publishInterval = chrono::seconds(intervalSeconds);
+    const chrono::milliseconds publishDeadline = cycleDeadline(publishInterval);
+
+    // 틱 격자를 벽시계 틱 경계에 맞춤 (첫 advance가 firstTick 시각에 실행됨)
+    const auto firstTick = nextBoundary(TICK_INTERVAL);
+    auto nextTick = toSteady(firstTick) - TICK_INTERVAL;
+
+    for (size_t i = 0; i < schedules_.size(); i++)
     {
-        auto startTime = chrono::steady_clock::now();
-        collector.collect();
+        dispatchCollector(i);
 
-        lock_guard<mutex> lock(metricsMutex);
-        metrics.cpu = collector.getCpuInfo();
+        // 다음 실행이 자신의 주기 경계에 오도록 첫 등록만 남은 틱 수로 계산
+        auto untilBoundary = chrono::duration_cast<chrono::milliseconds>(nextBoundary(schedules_[i]->period) - firstTick);
+        timerWheel_.schedule(i, static_cast<uint64_t>(max<int64_t>(0, untilBoundary.count() / TICK_INTERVAL.count())) + 1);
+    }
 
-        auto endTime = chrono::steady_clock::now();
-        auto duration = chrono::duration_cast<chrono::milliseconds>(endTime - startTime);
-        cout << "[CPU 수집] 소요 시간: " << duration.count() << "ms" << endl;
-    };
+    auto cycleTime = nextBoundary(publishInterval);
+    auto nextPublish = toSteady(cycleTime);
+    bool publishPending = false;
+    chrono::steady_clock::time_point cycleStart;
+    chrono::system_clock::time_point pendingCycleTime;
+    vector<size_t> due;
+
+    lastBudgetCheck_ = chrono::steady_clock::now();
+    lastCpuTime_ = SelfMetrics::processCpuTime();
+
+    while (running.load())
+    {
+        nextTick += TICK_INTERVAL;
+        this_thread::sleep_until(nextTick);
+
+        // 틱을 놓쳤으면 간격을 늘리지 않고 놓친 만큼 휠을 전진
+        auto now = chrono::steady_clock::now();
+        uint64_t ticks = 1;
+        if (now - nextTick >= TICK_INTERVAL)
+        {
+            auto missed = static_cast<uint64_t>((now - nextTick) / TICK_INTERVAL);
+            ticks += missed;
+            nextTick += TICK_INTERVAL * static_cast<int64_t>(missed);
+            SelfMetrics::instance().recordTickOverrun(missed);
+        }
+
+        due.clear();
+        for (uint64_t t = 0; t < ticks; t++)
+        {
+            timerWheel_.advance(due);
+        }
+        for (size_t index : due)
+        {
+            dispatchCollector(index);
+            timerWheel_.schedule(index, toTicks(adaptPeriod(*schedules_[index])));
+        }
+
+        checkDeadlines();
+
+        now = chrono::steady_clock::now();
+        if (!publishPending && now >= nextPublish)
+        {
+            // 발행 시점을 통째로 놓쳤으면 가장 최근 경계로 건너뛰고 건너뛴 주기 수를 기록
+            auto missedCycles = static_cast<uint64_t>((now - nextPublish) / publishInterval);
+            if (missedCycles > 0)
+            {
+                cycleTime += publishInterval * static_cast<int64_t>(missedCycles);
+                SelfMetrics::instance().recordMissedCycles(missedCycles);
+                LOG_WARN("발행 시점 {}회를 놓쳐 건너뜁니다", missedCycles);
+            }
+
+            updateRateScale();
+
+            publishPending = true;
+            cycleStart = now;
+            pendingCycleTime = cycleTime;
+
+            // 다음 경계는 매번 벽시계로 다시 계산해 시계 보정에도 정렬을 유지
+            // (두 시계의 미세한 차이로 경계 직전에 깨어났다면 같은 경계가 다시 나오므로 한 주기 뒤로)
+            cycleTime = nextBoundary(publishInterval);
+            if (cycleTime == pendingCycleTime)
+            {
+                cycleTime += publishInterval;
+            }
+            nextPublish = toSteady(cycleTime);
+        }
+
+        if (publishPending && (cycleCompleted(cycleStart) || now >= cycleStart + publishDeadline))
+        {
+            publishSnapshot(cycleStart, pendingCycleTime);
+            publishPending = false;
+        }
+    }
 }
 
 /**
- * @brief 메모리 수집기에 대한 특수화된 작업 생성 함수
+ * @brief 마지막 수집 결과의 변화 정도와 CPU 예산 배율로 다음 수집 주기를 계산
  *
- * @param collector 메모리 수집기 인스턴스
- * @param metrics 시스템 메트릭 객체
- * @param metricsMutex 메트릭 접근 동기화를 위한 뮤텍스
- * @return function<void()> 메모리 정보 수집 작업 함수
+ * @param schedule 수집기 일정
+ * @return chrono::milliseconds 다음 실행까지의 주기
  *
- * 메모리 사용량을 수집하고 메트릭 객체에 저장합니다.
+ * CollectorOptions::adaptiveRate가 켜져 있으면 결과가 바뀌지 않을 때마다 주기를 두 배씩
+ * 기본 주기의 MAX_BACKOFF_FACTOR배까지 늘리고, 값이 바뀌면 기본 주기로 되돌리며,
+ * 값이 급변하면 기본 주기의 절반(최소 MIN_BURST_PERIOD)으로 앞당깁니다.
+ * CPU 예산을 넘은 동안에는 앞당기지 않고, 결과 주기에 rateScale_을 곱합니다.
  */
-template <>
-function<void()> CollectorManager::createCollectorTask<MemoryCollector>(
-    MemoryCollector &collector,
-    SystemMetrics &metrics,
-    mutex &metricsMutex)
+chrono::milliseconds CollectorManager::adaptPeriod(CollectorSchedule &schedule)
 {
-    return [&collector, &metrics, &metricsMutex]()
+    const chrono::milliseconds previous = schedule.adaptivePeriod;
+
+    if (options_.adaptiveRate)
     {
-        auto startTime = chrono::steady_clock::now();
-        collector.collect();
+        ChangeKind change;
+        {
+            lock_guard<mutex> lock(schedule.sectionMutex);
+            change = schedule.lastChange;
+        }
+
+        switch (change)
+        {
+        case ChangeKind::Unchanged:
+            schedule.adaptivePeriod = clamp(schedule.adaptivePeriod * 2, schedule.period,
+                                            schedule.period * MAX_BACKOFF_FACTOR);
+            break;
+        case ChangeKind::Burst:
+            schedule.adaptivePeriod = rateScale_ > 1.0 ? schedule.period
+                                                       : min(schedule.period, max(MIN_BURST_PERIOD, schedule.period / 2));
+            break;
+        case ChangeKind::Changed:
+            schedule.adaptivePeriod = schedule.period;
+            break;
+        }
+    }
 
-        lock_guard<mutex> lock(metricsMutex);
-        metrics.memory = collector.getMemoryInfo();
+    if (schedule.adaptivePeriod != previous)
+    {
+        LOG_DEBUG("[{}] 수집 주기 조정: {}ms -> {}ms", schedule.name, previous.count(), schedule.adaptivePeriod.count());
+    }
 
-        auto endTime = chrono::steady_clock::now();
-        auto duration = chrono::duration_cast<chrono::milliseconds>(endTime - startTime);
-        cout << "[메모리 수집] 소요 시간: " << duration.count() << "ms" << endl;
-    };
+    auto next = chrono::duration_cast<chrono::milliseconds>(schedule.adaptivePeriod * rateScale_);
+    SelfMetrics::instance().setPeriod(schedule.metricsSlot, next);
+    return next;
 }
 
 /**
- * @brief 디스크 수집기에 대한 특수화된 작업 생성 함수
+ * @brief 직전 확인 이후의 에이전트 CPU 사용률로 주기 배율을 갱신
  *
- * @param collector 디스크 수집기 인스턴스
- * @param metrics 시스템 메트릭 객체
- * @param metricsMutex 메트릭 접근 동기화를 위한 뮤텍스
- * @return function<void()> 디스크 정보 수집 작업 함수
- *
- * 디스크 사용량 통계를 수집하고 메트릭 객체에 저장합니다.
+ * getrusage로 얻은 프로세스 CPU 시간 증가분을 경과 시간으로 나눠 사용률(코어 하나 기준 %)을 구하고,
+ * 배율을 사용률/예산 비율만큼 곱해 1.0 ~ MAX_RATE_SCALE 범위로 제한합니다.
+ * 수집 비용은 주기에 거의 반비례하므로 배율은 몇 주기 안에 예산을 맞추는 값으로 수렴하고,
+ * 부하가 줄면 다시 1.0으로 돌아옵니다. CollectorOptions::cpuBudgetPercent가 0이면 측정만 갱신합니다.
  */
-template <>
-function<void()> CollectorManager::createCollectorTask<DiskCollector>(
-    DiskCollector &collector,
-    SystemMetrics &metrics,
-    mutex &metricsMutex)
+void CollectorManager::updateRateScale()
 {
-    return [&collector, &metrics, &metricsMutex]()
+    auto now = chrono::steady_clock::now();
+    auto cpuTime = SelfMetrics::processCpuTime();
+    chrono::duration<double> wall = now - lastBudgetCheck_;
+    chrono::duration<double> used = cpuTime - lastCpuTime_;
+    lastBudgetCheck_ = now;
+    lastCpuTime_ = cpuTime;
+
+    if (options_.cpuBudgetPercent <= 0.0 || wall.count() <= 0.0)
     {
-        auto startTime = chrono::steady_clock::now();
-        collector.collect();
+        return;
+    }
 
-        lock_guard<mutex> lock(metricsMutex);
-        metrics.disk = collector.getDiskStats();
+    double usagePercent = 100.0 * used.count() / wall.count();
+    double scale = clamp(rateScale_ * usagePercent / options_.cpuBudgetPercent, 1.0, MAX_RATE_SCALE);
 
-        auto endTime = chrono::steady_clock::now();
-        auto duration = chrono::duration_cast<chrono::milliseconds>(endTime - startTime);
-        cout << "[디스크 수집] 소요 시간: " << duration.count() << "ms" << endl;
-    };
+    if (scale > 1.0 && rateScale_ <= 1.0)
+    {
+        LOG_WARN("에이전트 CPU 사용률 {:.1f}%가 예산 {:.1f}%를 넘어 수집 주기를 늘립니다", usagePercent,
+                 options_.cpuBudgetPercent);
+    }
+    else if (scale <= 1.0 && rateScale_ > 1.0)
+    {
+        LOG_INFO("에이전트 CPU 사용률 {:.1f}%가 예산 이내로 돌아와 기본 수집 주기를 사용합니다", usagePercent);
+    }
+    if (fabs(scale - rateScale_) >= 0.01)
+    {
+        LOG_DEBUG("수집 주기 배율: {:.2f} -> {:.2f} (CPU 사용률 {:.1f}%)", rateScale_, scale, usagePercent);
+    }
+
+    rateScale_ = scale;
+    SelfMetrics::instance().setRateScale(rateScale_);
 }
 
 /**
- * @brief 네트워크 수집기에 대한 특수화된 작업 생성 함수
- *
- * @param collector 네트워크 수집기 인스턴스
- * @param metrics 시스템 메트릭 객체
- * @param metricsMutex 메트릭 접근 동기화를 위한 뮤텍스
- * @return function<void()> 네트워크 정보 수집 작업 함수
+ * @brief 발행 주기마다 수집 완료를 기다리는 최대 시간 계산
  *
- * 네트워크 인터페이스 정보를 수집하고 메트릭 객체에 저장합니다.
+ * @param publishInterval 스냅샷 발행 주기
+ * @return chrono::milliseconds CollectorOptions::cycleDeadlineMs 또는 발행 주기의 절반과 1초 중 작은 값
  */
-template <>
-function<void()> CollectorManager::createCollectorTask<NetworkCollector>(
-    NetworkCollector &collector,
-    SystemMetrics &metrics,
-    mutex &metricsMutex)
+chrono::milliseconds CollectorManager::cycleDeadline(chrono::milliseconds publishInterval) const
 {
-    return [&collector, &metrics, &metricsMutex]()
+    if (options_.cycleDeadlineMs > 0)
     {
-        auto startTime = chrono::steady_clock::now();
-        collector.collect();
-
-        lock_guard<mutex> lock(metricsMutex);
-        metrics.network = collector.getInterfacesToVector();
-
-        auto endTime = chrono::steady_clock::now();
-        auto duration = chrono::duration_cast<chrono::milliseconds>(endTime - startTime);
-        cout << "[네트워크 수집] 소요 시간: " << duration.count() << "ms" << endl;
-    };
+        return min(chrono::milliseconds(options_.cycleDeadlineMs), publishInterval);
+    }
+    return min(publishInterval / 2, chrono::milliseconds(1000));
 }
 
 /**
- * @brief 프로세스 수집기에 대한 특수화된 작업 생성 함수
+ * @brief 발행 시점 이전에 시작된 수집이 모두 끝났는지 확인
  *
- * @param collector 프로세스 수집기 인스턴스
- * @param metrics 시스템 메트릭 객체
- * @param metricsMutex 메트릭 접근 동기화를 위한 뮤텍스
- * @return function<void()> 프로세스 정보 수집 작업 함수
+ * @param cycleStart 발행 주기가 도래한 시각
+ * @return bool 기다릴 수집이 없으면 true
  *
- * 실행 중인 프로세스 정보를 수집하고 메트릭 객체에 저장합니다.
+ * 발행 시점 이후에 시작된 수집은 다음 스냅샷의 몫이므로 기다리지 않습니다.
  */
-template <>
-function<void()> CollectorManager::createCollectorTask<ProcessCollector>(
-    ProcessCollector &collector,
-    SystemMetrics &metrics,
-    mutex &metricsMutex)
+bool CollectorManager::cycleCompleted(chrono::steady_clock::time_point cycleStart) const
 {
-    return [&collector, &metrics, &metricsMutex]()
+    for (const auto &schedule : schedules_)
     {
-        auto startTime = chrono::steady_clock::now();
-        collector.collect();
-
-        lock_guard<mutex> lock(metricsMutex);
-        metrics.process = collector.getProcesses(0);
-
-        auto endTime = chrono::steady_clock::now();
-        auto duration = chrono::duration_cast<chrono::milliseconds>(endTime - startTime);
-        cout << "[프로세스 수집] 소요 시간: " << duration.count() << "ms" << endl;
-    };
+        if (schedule->inFlight.valid() && schedule->startedAt <= cycleStart &&
+            schedule->inFlight.wait_for(chrono::seconds(0)) != future_status::ready)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 /**
- * @brief 시스템 정보 수집기에 대한 특수화된 작업 생성 함수
+ * @brief 주기가 도래한 수집기를 실행하는 함수
  *
- * @param collector 시스템 정보 수집기 인스턴스
- * @param metrics 시스템 메트릭 객체
- * @param metricsMutex 메트릭 접근 동기화를 위한 뮤텍스
- * @return function<void()> 시스템 정보 수집 작업 함수
+ * @param index 수집기 일정 인덱스
  *
- * 기본 시스템 정보를 수집하고 메트릭 객체에 저장합니다.
+ * 이전 실행이 아직 끝나지 않은 수집기는 중복 실행하지 않고 이번 주기를 건너뜁니다.
  */
-template <>
-function<void()> CollectorManager::createCollectorTask<SystemInfoCollector>(
-    SystemInfoCollector &collector,
-    SystemMetrics &metrics,
-    mutex &metricsMutex)
+void CollectorManager::dispatchCollector(size_t index)
 {
-    return [&collector, &metrics, &metricsMutex]()
+    CollectorSchedule &schedule = *schedules_[index];
+
+    if (schedule.inFlight.valid() &&
+        schedule.inFlight.wait_for(chrono::seconds(0)) != future_status::ready)
     {
-        auto startTime = chrono::steady_clock::now();
-        collector.collect();
+        LOG_WARN("[{}] 이전 수집이 끝나지 않아 이번 주기를 건너뜁니다", schedule.name);
+        return;
+    }
 
-        lock_guard<mutex> lock(metricsMutex);
-        // 시스템 정보를 메트릭에 추가
-        metrics.system = collector.getSystemInfo();
+    schedule.startedAt = chrono::steady_clock::now();
+    schedule.overrunReported = false;
+    schedule.inFlight = workerPool_.submit([this, index]()
+                                           {
+        CollectorSchedule &target = *schedules_[index];
+        try
+        {
+            SelfMetrics::Timer timer(target.metricsSlot);
+            target.task();
+        }
+        catch (const exception &e)
+        {
+            SelfMetrics::instance().recordError(target.metricsSlot);
+            LOG_ERROR("[{}] 수집 중 예외 발생: {}", target.name, e.what());
+            return;
+        }
 
-        auto endTime = chrono::steady_clock::now();
-        auto duration = chrono::duration_cast<chrono::milliseconds>(endTime - startTime);
-        cout << "[시스템 정보 수집] 소요 시간: " << duration.count() << "ms" << endl;
-    };
+        lock_guard<mutex> lock(target.sectionMutex);
+        target.completedAt = chrono::steady_clock::now();
+        target.hasCompleted = true; });
 }
 
 /**
- * @brief 도커 수집기에 대한 특수화된 작업 생성 함수
- *
- * @param collector 도커 수집기 인스턴스
- * @param metrics 시스템 메트릭 객체
- * @param metricsMutex 메트릭 접근 동기화를 위한 뮤텍스
- * @return function<void()> 도커 컨테이너 정보 수집 작업 함수
+ * @brief 허용 시간을 초과해 실행 중인 수집기를 확인하는 함수
  *
- * 도커 컨테이너 정보를 수집하고 메트릭 객체에 저장합니다.
+ * 실행 시간이 허용 시간을 넘긴 수집기에 대해 실행당 한 번 경고를 기록합니다.
  */
-template <>
-function<void()> CollectorManager::createCollectorTask<DockerCollector>(
-    DockerCollector &collector,
-    SystemMetrics &metrics,
-    mutex &metricsMutex)
+void CollectorManager::checkDeadlines()
 {
-    return [&collector, &metrics, &metricsMutex]()
+    auto now = chrono::steady_clock::now();
+    for (auto &entry : schedules_)
     {
-        auto startTime = chrono::steady_clock::now();
-        collector.collect();
-
-        lock_guard<mutex> lock(metricsMutex);
-        metrics.docker = collector.getContainers();
+        CollectorSchedule &schedule = *entry;
+        if (schedule.overrunReported || !schedule.inFlight.valid() ||
+            schedule.inFlight.wait_for(chrono::seconds(0)) == future_status::ready)
+        {
+            continue;
+        }
 
-        auto endTime = chrono::steady_clock::now();
-        auto duration = chrono::duration_cast<chrono::milliseconds>(endTime - startTime);
-        cout << "[도커 수집] 소요 시간: " << duration.count() << "ms" << endl;
-    };
+        auto elapsed = chrono::duration_cast<chrono::milliseconds>(now - schedule.startedAt);
+        if (elapsed > schedule.deadline)
+        {
+            LOG_WARN("[{}] 수집 허용 시간 초과: {}ms", schedule.name, elapsed.count());
+            schedule.overrunReported = true;
+        }
+    }
 }
 
 /**
- * @brief 서비스 수집기에 대한 특수화된 작업 생성 함수
+ * @brief 수집기를 레지스트리에 등록하는 템플릿 함수
  *
- * @param collector 서비스 수집기 인스턴스
- * @param metrics 시스템 메트릭 객체
- * @param metricsMutex 메트릭 접근 동기화를 위한 뮤텍스
- * @return function<void()> 서비스 정보 수집 작업 함수
+ * @tparam CollectorType 수집기 타입
+ * @tparam Field 수집기가 담당하는 SystemMetrics 필드 타입
+ * @tparam Fill 수집기 인스턴스의 결과를 기존 필드 버퍼에 채우는 함수 타입
+ * @param name 수집기 이름
+ * @param section 스냅샷에서 담당하는 섹션 이름 (JSON 키와 동일)
+ * @param period 기본 수집 주기
+ * @param field 수집 결과를 기록할 SystemMetrics 멤버
+ * @param fill 수집기 인스턴스의 결과를 버퍼에 채우는 함수
+ * @param change 직전 결과와 새 결과를 비교해 ChangeKind를 반환하는 함수
+ *
+ * 수집기 인스턴스는 첫 실행 시점에 작업자 스레드에서 생성되므로 비활성화된 수집기는
+ * 생성 비용도 발생하지 않습니다. 각 수집기는 자신의 SectionBuffer 뒤쪽 버퍼를 잠금 없이 채운 뒤
+ * 수집기별 sectionMutex 아래에서 앞뒤만 교체하므로 수집기 간 잠금 경합이 없고,
+ * 스냅샷 복사가 수집 시간 동안 막히지도 않습니다. 새 결과는 앞쪽 버퍼의 직전 결과와 비교해
+ * 변화 정도를 기록하며, 수집 루프는 이를 다음 주기 계산에 사용합니다.
+ */
+template <typename CollectorType, typename Field, typename Fill, typename Change>
+void CollectorManager::addCollector(const string &name, const string &section, chrono::milliseconds period,
+                                    Field SystemMetrics::*field, Fill fill, Change change)
+{
+    addCollector<CollectorType, Field>(
+        name, section, period, [field](SystemMetrics &snapshot, const Field &value)
+        { snapshot.*field = value; },
+        fill, change);
+}
+
+/**
+ * @brief 결과를 스냅샷의 여러 멤버에 나눠 기록하는 수집기를 레지스트리에 등록하는 템플릿 함수
  *
- * 시스템 서비스 정보를 수집하고 메트릭 객체에 저장합니다.
+ * @tparam CollectorType 수집기 타입
+ * @tparam Field 수집기 결과 버퍼 타입
+ * @tparam Store 결과 버퍼를 스냅샷에 복사하는 함수 타입
+ * @tparam Fill 수집기 인스턴스의 결과를 기존 필드 버퍼에 채우는 함수 타입
+ * @param name 수집기 이름
+ * @param section 스냅샷에서 담당하는 섹션 이름
+ * @param period 기본 수집 주기
+ * @param store 결과 버퍼를 스냅샷에 복사하는 함수
+ * @param fill 수집기 인스턴스의 결과를 버퍼에 채우는 함수
+ * @param change 직전 결과와 새 결과를 비교해 ChangeKind를 반환하는 함수
  */
-template <>
-function<void()> CollectorManager::createCollectorTask<ServiceCollector>(
-    ServiceCollector &collector,
-    SystemMetrics &metrics,
-    mutex &metricsMutex)
+template <typename CollectorType, typename Field, typename Store, typename Fill, typename Change>
+void CollectorManager::addCollector(const string &name, const string &section, chrono::milliseconds period,
+                                    Store store, Fill fill, Change change)
 {
-    return [&collector, &metrics, &metricsMutex]()
+    knownCollectors_.insert(name);
+    if (!isCollectorEnabled(name))
     {
-        auto startTime = chrono::steady_clock::now();
-        collector.collect();
+        LOG_INFO("[{}] 수집기 비활성화됨", name);
+        return;
+    }
+
+    auto schedule = make_unique<CollectorSchedule>();
+    CollectorSchedule *slot = schedule.get();
+    slot->name = name;
+    slot->section = section;
+    slot->period = period;
+    slot->adaptivePeriod = period;
+    slot->deadline = period;
+    slot->metricsSlot = SelfMetrics::instance().registerCollector(name);
+
+    auto buffers = make_shared<SectionBuffer<Field>>();
+
+    // 같은 수집기의 실행은 dispatchCollector가 겹치지 않게 보장하므로 인스턴스와 뒤쪽 버퍼 접근에 잠금이 필요 없음
+    slot->task = [this, slot, buffers, fill, change, collector = shared_ptr<CollectorType>()]() mutable
+    {
+        if (!collector)
+        {
+            // 전용 옵션을 받는 수집기는 실행 옵션의 해당 항목으로 생성
+            if constexpr (is_constructible_v<CollectorType, const ProcessOptions &>)
+            {
+                collector = make_shared<CollectorType>(options_.process);
+            }
+            else
+            {
+                collector = make_shared<CollectorType>();
+            }
+            if constexpr (is_base_of_v<Collector, CollectorType>)
+            {
+                collector->setWorkerPool(&workerPool_);
+                collector->setMetricsSlot(slot->metricsSlot);
+            }
+        }
+
+        collector->collect();
+        Field &back = buffers->slots[1 - buffers->front];
+        fill(*collector, back);
+
+        // 앞쪽 버퍼는 이 작업만 교체하므로 잠금 없이 읽어도 됨 (스냅샷 복사와는 읽기끼리만 겹침)
+        ChangeKind kind = buffers->filled ? change(buffers->slots[buffers->front], back) : ChangeKind::Changed;
+        buffers->filled = true;
 
-        lock_guard<mutex> lock(metricsMutex);
-        metrics.services = collector.getServiceInfo();
-        auto endTime = chrono::steady_clock::now();
-        auto duration = chrono::duration_cast<chrono::milliseconds>(endTime - startTime);
-        cout << "[서비스 수집] 소요 시간: " << duration.count() << "ms" << endl;
+        lock_guard<mutex> lock(slot->sectionMutex);
+        buffers->front = 1 - buffers->front;
+        slot->lastChange = kind;
+    };
+
+    slot->copySection = [buffers, store](SystemMetrics &snapshot)
+    {
+        store(snapshot, buffers->slots[buffers->front]);
     };
+
+    schedules_.push_back(move(schedule));
 }
 
 /**
- * @brief 병렬로 여러 수집기의 데이터를 동시에 수집하는 함수
+ * @brief 시스템 데이터 수집 작업 시작
+ *
+ * @param intervalSeconds 스냅샷 발행 주기이자 수집기 기본 수집 주기(초 단위, 기본값: 5)
  *
- * 모든 수집기를 비동기적으로 실행하여 동시에 데이터를 수집하고,
- * 결과를 하나의 메트릭 객체에 취합합니다.
- * 수집이 완료되면 데이터 큐에 메트릭을 추가합니다.
+ * 수집기별 기본 주기는 다음과 같으며 CollectorOptions::periods로 재정의할 수 있습니다.
+ * - cpu, memory, pressure, disk, network, process: 발행 주기와 동일
+ * - docker: 최소 15초, service, system: 최소 30초
+ *
+ * 변화 판정 기준은 다음과 같으며 pressure, network, process는 항상 기본 주기를 유지합니다.
+ * - cpu, memory: 사용률이 CPU_BURST_THRESHOLD, MEMORY_BURST_THRESHOLD 이상 바뀌면 급변
+ * - disk: 장치, 마운트 지점, 파일 시스템, 총 용량 구성이 같고 사용률 변화가 DISK_CHANGE_THRESHOLD 미만이면 변화 없음
+ * - system: 호스트 이름, 운영체제, 커널, 부팅 시각이 같으면 변화 없음
+ * - docker: 컨테이너 ID, 이름, 이미지, 상태 종류(Up, Exited 등)가 같고
+ *   CPU/메모리 사용률 변화가 LOAD_CHANGE_THRESHOLD 미만이면 변화 없음
+ * - service: 서비스 이름, 활성화 여부, 상태가 같고 CPU 사용률 변화가 LOAD_CHANGE_THRESHOLD 미만이면 변화 없음
+ *
+ * CollectorOptions의 활성화/비활성화 목록에서 제외된 수집기와 도커 소켓 또는 systemd가
+ * 없는 노드의 docker, service 수집기는 등록하지 않습니다.
  */
-void CollectorManager::collectDataParallel()
+void CollectorManager::start(int intervalSeconds)
 {
-    // 시작 시간 기록
-    auto collectStartTime = chrono::steady_clock::now();
-    string startTimestamp = getCurrentTime();
+    const chrono::milliseconds interval = chrono::seconds(intervalSeconds);
+    const chrono::milliseconds slowInterval = max(interval, chrono::milliseconds(chrono::seconds(15)));
+    const chrono::milliseconds staticInterval = max(interval, chrono::milliseconds(chrono::seconds(30)));
 
-    SystemMetrics metrics;
-    metrics.key = systemKey_;
-    metrics.timestamp = startTimestamp;
+    schedules_.clear();
+    knownCollectors_.clear();
+
+    // 호스트마다 고정된 지터 (같은 시스템 키는 재시작 후에도 같은 오프셋)
+    jitter_ = chrono::milliseconds(0);
+    if (options_.jitterMs > 0)
+    {
+        jitter_ = chrono::milliseconds(hash<string>{}(systemKey_) % (static_cast<size_t>(options_.jitterMs) + 1));
+        LOG_INFO("발행 시점 지터: {}ms", jitter_.count());
+    }
+    addCollector<CPUCollector>("cpu", "cpu", interval, &SystemMetrics::cpu,
+                               [](const CPUCollector &collector, CpuInfo &out)
+                               { out = collector.getCpuInfo(); },
+                               [](const CpuInfo &previous, const CpuInfo &current)
+                               { return fabs(current.usage - previous.usage) >= CPU_BURST_THRESHOLD ? ChangeKind::Burst
+                                                                                                   : ChangeKind::Changed; });
+    addCollector<MemoryCollector>("memory", "memory", interval, &SystemMetrics::memory,
+                                  [](const MemoryCollector &collector, MemoryInfo &out)
+                                  { out = collector.getMemoryInfo(); },
+                                  [](const MemoryInfo &previous, const MemoryInfo &current)
+                                  { return fabs(current.usage_percent - previous.usage_percent) >= MEMORY_BURST_THRESHOLD
+                                               ? ChangeKind::Burst
+                                               : ChangeKind::Changed; });
+
+    // PSI와 schedstat이 모두 없는 커널에서는 해당 수집기를 아예 생성하지 않음
+    if (access(PRESSURE_PATH, F_OK) == 0 || access(SCHEDSTAT_PATH, F_OK) == 0)
+    {
+        addCollector<PressureCollector>("pressure", "pressure", interval, &SystemMetrics::pressure,
+                                        [](const PressureCollector &collector, PressureInfo &out)
+                                        { out = collector.getPressureInfo(); });
+    }
+    else
+    {
+        knownCollectors_.insert("pressure");
+        LOG_INFO("[pressure] {} 없음 - 수집기를 건너뜁니다", PRESSURE_PATH);
+    }
+
+    addCollector<DiskCollector>("disk", "disk", interval, &SystemMetrics::disk,
+                                [](const DiskCollector &collector, vector<DiskInfo> &out)
+                                { out = collector.getDiskStats(); },
+                                [](const vector<DiskInfo> &previous, const vector<DiskInfo> &current)
+                                {
+                                    bool same = equal(previous.begin(), previous.end(), current.begin(), current.end(),
+                                                      [](const DiskInfo &a, const DiskInfo &b)
+                                                      { return a.device == b.device && a.mount_point == b.mount_point &&
+                                                               a.filesystem_type == b.filesystem_type && a.total == b.total &&
+                                                               fabs(a.usage_percent - b.usage_percent) < DISK_CHANGE_THRESHOLD; });
+                                    return same ? ChangeKind::Unchanged : ChangeKind::Changed;
+                                });
+    addCollector<NetworkCollector>("network", "network", interval, &SystemMetrics::network,
+                                   [](const NetworkCollector &collector, vector<NetworkInterface> &out)
+                                   { collector.getInterfacesToVector(out); });
+    addCollector<ProcessCollector, ProcessSection>("process", "processes", interval,
+                                                   [](SystemMetrics &snapshot, const ProcessSection &section)
+                                                   {
+                                                       snapshot.process = section.processes;
+                                                       snapshot.process_trees = section.trees;
+                                                       snapshot.cgroups = section.cgroups;
+                                                   },
+                                                   [this](const ProcessCollector &collector, ProcessSection &out)
+                                                   {
+                                                       collector.getProcesses(0, out.processes);
+                                                       out.trees = collector.getProcessTrees();
+                                                       out.cgroups = collector.getCgroups();
+                                                       appendProcessEvents(collector.getProcessEvents());
+                                                   });
+    addCollector<SystemInfoCollector>("system", "system", staticInterval, &SystemMetrics::system,
+                                      [](const SystemInfoCollector &collector, SystemInfo &out)
+                                      { out = collector.getSystemInfo(); },
+                                      [](const SystemInfo &previous, const SystemInfo &current)
+                                      {
+                                          bool same = previous.hostname == current.hostname && previous.os_name == current.os_name &&
+                                                      previous.os_version == current.os_version &&
+                                                      previous.os_kernel_version == current.os_kernel_version &&
+                                                      previous.boot_time == current.boot_time;
+                                          return same ? ChangeKind::Unchanged : ChangeKind::Changed;
+                                      });
+
+    // 도커 소켓이나 systemd가 없는 노드에서는 해당 수집기를 아예 생성하지 않음
+    if (access(DOCKER_SOCKET_PATH, F_OK) == 0)
+    {
+        addCollector<DockerCollector>("docker", "containers", slowInterval, &SystemMetrics::docker,
+                                      [](const DockerCollector &collector, vector<DockerContainerInfo> &out)
+                                      { collector.getContainers(out); },
+                                      [](const vector<DockerContainerInfo> &previous, const vector<DockerContainerInfo> &current)
+                                      {
+                                          // "Up 5 minutes"처럼 시간이 붙는 상태 문자열은 첫 단어만 비교
+                                          auto state = [](const string &status)
+                                          { return status.substr(0, status.find(' ')); };
+                                          bool same = equal(previous.begin(), previous.end(), current.begin(), current.end(),
+                                                            [&state](const DockerContainerInfo &a, const DockerContainerInfo &b)
+                                                            { return a.container_id == b.container_id &&
+                                                                     a.container_name == b.container_name &&
+                                                                     a.container_image == b.container_image &&
+                                                                     state(a.container_status) == state(b.container_status) &&
+                                                                     fabs(a.cpu_usage - b.cpu_usage) < LOAD_CHANGE_THRESHOLD &&
+                                                                     fabs(a.memory_percent - b.memory_percent) < LOAD_CHANGE_THRESHOLD; });
+                                          return same ? ChangeKind::Unchanged : ChangeKind::Changed;
+                                      });
+    }
+    else
+    {
+        knownCollectors_.insert("docker");
+        LOG_INFO("[docker] {} 없음 - 수집기를 건너뜁니다", DOCKER_SOCKET_PATH);
+    }
 
-    // 동시 접근 보호를 위한 뮤텍스
-    mutex metricsMutex;
+    if (access(SYSTEMD_RUNTIME_PATH, F_OK) == 0)
+    {
+        addCollector<ServiceCollector>("service", "services", staticInterval, &SystemMetrics::services,
+                                       [](const ServiceCollector &collector, vector<ServiceInfo> &out)
+                                       { out = collector.getServiceInfoRef(); },
+                                       [](const vector<ServiceInfo> &previous, const vector<ServiceInfo> &current)
+                                       {
+                                           bool same = equal(previous.begin(), previous.end(), current.begin(), current.end(),
+                                                             [](const ServiceInfo &a, const ServiceInfo &b)
+                                                             { return a.name == b.name && a.enabled == b.enabled &&
+                                                                      a.active_state == b.active_state && a.sub_state == b.sub_state &&
+                                                                      fabs(a.cpu_usage - b.cpu_usage) < LOAD_CHANGE_THRESHOLD; });
+                                           return same ? ChangeKind::Unchanged : ChangeKind::Changed;
+                                       });
+    }
+    else
+    {
+        knownCollectors_.insert("service");
+        LOG_INFO("[service] {} 없음 - 수집기를 건너뜁니다", SYSTEMD_RUNTIME_PATH);
+    }
 
-    // 각 수집기에 대한 비동기 작업 생성
-    vector<future<void>> tasks;
+    for (const auto *names : {&options_.enabledCollectors, &options_.disabledCollectors})
+    {
+        for (const auto &name : *names)
+        {
+            if (knownCollectors_.count(name) == 0)
+            {
+                LOG_WARN("알 수 없는 수집기 이름: {}", name);
+            }
+        }
+    }
 
-    // 템플릿 함수를 사용하여 각 수집기에 대한 작업 생성 및 실행
-    tasks.push_back(async(launch::async,
-                          createCollectorTask(cpuCollector_, metrics, metricsMutex)));
+    for (const auto &period : options_.periods)
+    {
+        auto it = find_if(schedules_.begin(), schedules_.end(), [&period](const unique_ptr<CollectorSchedule> &schedule)
+                          { return schedule->name == period.first; });
+        if (it == schedules_.end())
+        {
+            LOG_WARN("등록되지 않았거나 비활성화된 수집기의 주기는 무시합니다: {}", period.first);
+            continue;
+        }
+        if (period.second <= 0)
+        {
+            LOG_WARN("[{}] 잘못된 수집 주기: {}초", period.first, period.second);
+            continue;
+        }
+        (*it)->period = chrono::seconds(period.second);
+        (*it)->adaptivePeriod = (*it)->period;
+        (*it)->deadline = (*it)->period;
+    }
 
-    tasks.push_back(async(launch::async,
-                          createCollectorTask(memoryCollector_, metrics, metricsMutex)));
+    if (options_.adaptiveRate)
+    {
+        LOG_INFO("변화량에 따른 수집 주기 조정 사용 (최대 {}배)", MAX_BACKOFF_FACTOR);
+    }
+    if (options_.cpuBudgetPercent > 0.0)
+    {
+        LOG_INFO("에이전트 CPU 예산: {:.1f}%", options_.cpuBudgetPercent);
+    }
+    rateScale_ = 1.0;
+    SelfMetrics::instance().setRateScale(rateScale_);
 
-    tasks.push_back(async(launch::async,
-                          createCollectorTask(diskCollector_, metrics, metricsMutex)));
+    for (const auto &schedule : schedules_)
+    {
+        LOG_INFO("[{}] 수집 주기: {}ms", schedule->name, schedule->period.count());
+        SelfMetrics::instance().setPeriod(schedule->metricsSlot, schedule->period);
+    }
 
-    tasks.push_back(async(launch::async,
-                          createCollectorTask(networkCollector_, metrics, metricsMutex)));
+    collectionThread_ = thread(&CollectorManager::collectLoop, this, intervalSeconds);
+}
 
-    tasks.push_back(async(launch::async,
-                          createCollectorTask(processCollector_, metrics, metricsMutex)));
+/**
+ * @brief 최신 수집 결과로 스냅샷을 만들어 큐에 추가하는 함수
+ *
+ * @param cycleStart 발행 주기가 도래한 시각
+ * @param cycleTime 발행 주기의 벽시계 경계 시각
+ *
+ * 각 수집기가 마지막으로 반영한 결과를 하나의 메트릭 객체로 복사하고,
+ * 시스템 키와 발행 주기의 경계 시각을 채워 데이터 큐에 추가합니다.
+ * 서버 장애로 전송기가 큐를 비우지 못해도 드롭 정책에 따라 수집 루프는 멈추지 않습니다.
+ * 메트릭 객체는 재사용 큐에 돌아온 이전 스냅샷이 있으면 그것을 덮어써
+ * 벡터와 문자열 버퍼를 재사용하고, 없을 때만 새로 만듭니다.
+ * 한 번도 완료되지 않았거나 발행 시점 이전에 시작한 수집이 아직 끝나지 않은
+ * 수집기의 섹션은 stale_sections에 기록합니다.
+ */
+void CollectorManager::publishSnapshot(chrono::steady_clock::time_point cycleStart, chrono::system_clock::time_point cycleTime)
+{
+    auto publishStartTime = chrono::steady_clock::now();
+    string timestamp = formatTimestamp(cycleTime);
 
-    tasks.push_back(async(launch::async,
-                          createCollectorTask(systemInfoCollector_, metrics, metricsMutex)));
+    SystemMetrics metrics;
+    recycleQueue_->try_pop(metrics, chrono::milliseconds(0));
+    metrics.stale_sections.clear();
 
-    tasks.push_back(async(launch::async,
-                          createCollectorTask(dockerCollector_, metrics, metricsMutex)));
+    for (const auto &schedule : schedules_)
+    {
+        lock_guard<mutex> lock(schedule->sectionMutex);
+        schedule->copySection(metrics);
 
-    tasks.push_back(async(launch::async,
-                          createCollectorTask(serviceCollector_, metrics, metricsMutex)));
+        bool late = schedule->inFlight.valid() && schedule->startedAt <= cycleStart &&
+                    (!schedule->hasCompleted || schedule->completedAt < schedule->startedAt);
+        if (!schedule->hasCompleted || late)
+        {
+            metrics.stale_sections.push_back(schedule->section);
+        }
+    }
 
-    // 모든 작업이 완료될 때까지 대기
-    for (auto &task : tasks)
+    if (!metrics.stale_sections.empty())
     {
-        if (task.valid())
+        string sections;
+        for (const auto &section : metrics.stale_sections)
         {
-            task.wait();
+            sections += (sections.empty() ? "" : ", ") + section;
         }
+        LOG_WARN("허용 시간 내에 갱신되지 못한 섹션: {}", sections);
+    }
+
+    // 이벤트는 발행마다 한 번만 내보내고 비움 (재사용 스냅샷의 용량은 대기 목록이 넘겨받음)
+    {
+        lock_guard<mutex> lock(eventsMutex_);
+        metrics.process_events.swap(pendingEvents_);
+        pendingEvents_.clear();
+    }
+
+    metrics.key = systemKey_;
+    metrics.timestamp = timestamp;
+
+    SelfMetrics::instance().setQueueState(SelfMetrics::Queue::Metrics, dataQueue_->size(), dataQueue_->dropped());
+    metrics.agent = SelfMetrics::instance().snapshot();
+
+    // 완성된 metrics를 큐에 추가 (가득 찼을 때는 CollectorOptions::queue의 정책에 따라 대기하지 않고 드롭)
+    uint64_t droppedBefore = dataQueue_->dropped();
+    dataQueue_->push(move(metrics));
+    if (dataQueue_->dropped() != droppedBefore)
+    {
+        LOG_WARN("메트릭 큐가 가득 차 스냅샷을 버렸습니다 (누적 {}개)", dataQueue_->dropped());
     }
 
-    // 완성된 metrics를 큐에 추가
-    dataQueue_.push(move(metrics));
+    auto publishDuration = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - publishStartTime);
+    LOG_DEBUG("[수집] 스냅샷 발행: {}, 소요 시간: {}ms", timestamp, publishDuration.count());
+}
+
+/**
+ * @brief 프로세스 수집기가 이번 수집에서 받은 이벤트를 발행 대기 목록에 추가합니다.
+ *
+ * 발행이 밀려 대기 목록이 ProcessOptions::eventCapacity를 넘으면 가장 오래된 이벤트부터 버립니다.
+ *
+ * @param events 추가할 이벤트
+ */
+void CollectorManager::appendProcessEvents(const vector<ProcessEventInfo> &events)
+{
+    if (events.empty())
+    {
+        return;
+    }
 
-    // 종료 시간 기록 및 소요 시간 계산
-    auto collectEndTime = chrono::steady_clock::now();
-    auto collectDuration = chrono::duration_cast<chrono::milliseconds>(collectEndTime - collectStartTime);
+    lock_guard<mutex> lock(eventsMutex_);
+    pendingEvents_.insert(pendingEvents_.end(), events.begin(), events.end());
 
-    // 시작 및 종료 시간, 소요 시간 출력
-    char buffer[100];
-    snprintf(buffer, sizeof(buffer), "[수집] 시작: %s, 종료: %s, 소요 시간: %ldms", startTimestamp.c_str(), getCurrentTime().c_str(), collectDuration.count());
-    cout << "\033[2J\033[H";  // 화면 전체 지우고 커서를 왼쪽 상단으로
-    cout << buffer << endl;
-    LOG_INFO(buffer);
+    const size_t capacity = max<size_t>(options_.process.eventCapacity, 1);
+    if (pendingEvents_.size() > capacity)
+    {
+        size_t dropped = pendingEvents_.size() - capacity;
+        pendingEvents_.erase(pendingEvents_.begin(), pendingEvents_.begin() + static_cast<ptrdiff_t>(dropped));
+        LOG_WARN("발행되지 않은 프로세스 이벤트가 가득 차 {}개를 버렸습니다", dropped);
+    }
 }
 
 /**
- * @brief 현재 시간 정보를 문자열로 생성하는 함수
+ * @brief 시각을 타임스탬프 문자열로 생성하는 함수
  *
- * @return string 현재 시간 문자열
+ * @param time 변환할 시각
+ * @return string 시간 문자열
  *
  * UTC 시간을 ISO 8601 형식(YYYY-MM-DDThh:mm:ssZ)으로 반환합니다.
  */
-string CollectorManager::getCurrentTime()
+string CollectorManager::formatTimestamp(chrono::system_clock::time_point time)
 {
-    auto now = chrono::system_clock::now();
-    auto now_time_t = chrono::system_clock::to_time_t(now);
-    auto now_tm = *gmtime(&now_time_t); // UTC 시간 사용
+    auto time_value = chrono::system_clock::to_time_t(time);
+    tm time_tm{};
+    gmtime_r(&time_value, &time_tm); // UTC 시간 사용
 
     char buffer[30];
-    strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &now_tm);
+    strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &time_tm);
     return string(buffer);
 }
\ No newline at end of file
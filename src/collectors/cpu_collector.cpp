@@ -5,6 +5,8 @@
  */
 
 #include "collectors/cpu_collector.h"
+#include "common/proc_file.h"
+#include <algorithm>
 #include <string.h>
 #include <unistd.h>
 #include <stdio.h>
@@ -12,6 +14,8 @@
 #include <sensors/sensors.h>
 #include <time.h>
 #include <sys/utsname.h>
+#include <dirent.h>
+#include <fcntl.h>
 using namespace std;
 
 namespace
@@ -21,6 +25,52 @@ namespace
      * @details libsensors 라이브러리의 초기화 상태를 추적합니다.
      */
     bool sensors_initialized = false;
+
+    /**
+     * @brief CPU별 sysfs 디렉토리의 상위 경로
+     */
+    constexpr const char *CPU_SYSFS_DIR = "/sys/devices/system/cpu";
+
+    /**
+     * @brief 아직 열어 보지 않은 cpufreq fd 자리를 나타내는 값
+     */
+    constexpr int FREQ_FD_UNOPENED = -2;
+
+    /**
+     * @brief 열린 cpufreq 속성 fd에서 주파수(kHz)를 읽음
+     *
+     * @param fd 속성 파일 fd (오프셋 0부터 다시 읽음)
+     * @param khz 읽은 주파수 (kHz)
+     * @return bool 숫자를 읽었으면 true
+     */
+    bool readKhz(int fd, uint64_t &khz)
+    {
+        char buf[32];
+        ssize_t n = pread(fd, buf, sizeof(buf), 0);
+        if (n <= 0 || buf[0] < '0' || buf[0] > '9')
+            return false;
+
+        ProcFile::parseUnsigned(buf, buf + n, khz);
+        return true;
+    }
+
+    /**
+     * @brief cpufreq 속성 파일 하나에서 주파수(kHz)를 읽음
+     *
+     * @param path 속성 파일 경로
+     * @param khz 읽은 주파수 (kHz)
+     * @return bool 파일이 있고 숫자를 읽었으면 true
+     */
+    bool readKhz(const string &path, uint64_t &khz)
+    {
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+
+        bool ok = readKhz(fd, khz);
+        close(fd);
+        return ok;
+    }
 }
 
 /**
@@ -242,105 +292,78 @@ void CPUCollector::collect()
         }
     }
 
-    FILE *pStat = NULL;
-    char line[256];
-
-    pStat = fopen("/proc/stat", "r");
-    if (pStat == NULL)
+    // /proc/stat은 같은 틱에 실행되는 다른 수집기와 한 번만 읽어 공유
+    auto parseStat = [this](string_view text)
     {
-        // 파일 열기 실패 시 이전 값 유지
-        return;
-    }
+        const char *begin = text.data();
+        const char *end = begin + text.size();
 
-    // 전체 CPU 사용량 읽기
-    if (fgets(line, sizeof(line), pStat))
-    {
-        sscanf(line, "cpu %ld %ld %ld %ld", &curJiffies.user,
-               &curJiffies.nice, &curJiffies.system, &curJiffies.idle);
-    }
-
-    // 각 코어별 사용량 읽기
-    vector<stJiffies> newCoreJiffies;
-    newCoreJiffies.reserve(prevCoreJiffies.size()); // 메모리 재할당 방지
-    size_t core_id = 0;                             // 코어 ID 추적
+        // cpu 줄은 파일 맨 앞에 연속으로 나오므로 먼저 줄 수를 세어 표 크기를 맞춤
+        size_t rows = 0;
+        for (const char *p = begin; end - p > 3 && memcmp(p, "cpu", 3) == 0; rows++)
+        {
+            const char *eol = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+            p = eol ? eol + 1 : end;
+        }
+        if (curJiffies.rows != rows)
+        {
+            curJiffies.resize(rows);
+        }
 
-    while (fgets(line, sizeof(line), pStat))
-    {
-        stJiffies coreJiffies;
-        if (sscanf(line, "cpu%*d %ld %ld %ld %ld",
-                   &coreJiffies.user, &coreJiffies.nice,
-                   &coreJiffies.system, &coreJiffies.idle) == 4)
+        // 오래된 커널에서 없는 열은 0으로 남음
+        const char *p = begin;
+        for (size_t row = 0; row < rows; row++)
         {
-            newCoreJiffies.push_back(coreJiffies);
+            const char *eol = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+            if (!eol)
+                eol = end;
 
-            // cores 벡터 크기 조정 (필요시)
-            if (core_id >= cpuInfo.cores.size())
+            // 오프라인 코어는 줄이 없으므로 행 번호가 아닌 cpuN의 N을 코어 번호로 사용
+            const char *q = p + 3;
+            if (q < eol && *q >= '0' && *q <= '9')
             {
-                CpuCoreInfo newCore;
-                newCore.id = core_id;
-                newCore.usage = 0.0f;
-                newCore.temperature = 0.0f;
-                cpuInfo.cores.push_back(newCore);
+                uint64_t id = 0;
+                q = ProcFile::parseUnsigned(q, eol, id);
+                curJiffies.ids[row] = static_cast<size_t>(id);
             }
-            else
+            for (size_t c = 0; c < JiffyTable::COLUMNS; c++)
             {
-                // ID 값 설정
-                cpuInfo.cores[static_cast<size_t>(core_id)].id = static_cast<size_t>(core_id);
+                q = ProcFile::parseUnsigned(q, eol, curJiffies.column(c)[row]);
             }
-            core_id++;
-        }
-        else
-        {
-            break; // cpu 정보가 아닌 줄을 만나면 중단
+
+            p = eol + 1;
         }
+    };
+    if (!SharedProcFile::stat().read(parseStat) || curJiffies.rows == 0)
+    {
+        // 파일 읽기 실패 시 이전 값 유지
+        return;
     }
 
-    // 전체 CPU 사용률 계산
-    // 초기 상태가 아닐 때만 CPU 사용률 계산
-    if (prevJiffies.user != 0 || prevJiffies.nice != 0 ||
-        prevJiffies.system != 0 || prevJiffies.idle != 0)
+    // cores 벡터 크기 조정 (필요시)
+    const size_t core_count = curJiffies.rows - 1;
+    for (size_t core_id = cpuInfo.cores.size(); core_id < core_count; core_id++)
     {
-
-        struct stJiffies diffJiffies;
-        diffJiffies.user = curJiffies.user - prevJiffies.user;
-        diffJiffies.nice = curJiffies.nice - prevJiffies.nice;
-        diffJiffies.system = curJiffies.system - prevJiffies.system;
-        diffJiffies.idle = curJiffies.idle - prevJiffies.idle;
-
-        long int totalJiffies = diffJiffies.user + diffJiffies.nice +
-                                diffJiffies.system + diffJiffies.idle;
-
-        if (totalJiffies > 0)
-        {
-            double idle_ratio = static_cast<double>(diffJiffies.idle) / static_cast<double>(totalJiffies);
-            cpuInfo.usage = static_cast<float>(100.0 * (1.0 - idle_ratio));
-        }
+        CpuCoreInfo newCore;
+        newCore.id = core_id;
+        newCore.usage = 0.0f;
+        newCore.temperature = 0.0f;
+        newCore.speed = 0.0f;
+        cpuInfo.cores.push_back(newCore);
     }
-
-    // 각 코어별 사용률 계산
-    cpuInfo.cores.resize(newCoreJiffies.size());
-    if (!prevCoreJiffies.empty())
+    cpuInfo.cores.resize(core_count);
+    for (size_t i = 0; i < core_count; i++)
     {
-        for (size_t i = 0; i < newCoreJiffies.size(); ++i)
-        {
-            stJiffies diff;
-            diff.user = newCoreJiffies[i].user - prevCoreJiffies[i].user;
-            diff.nice = newCoreJiffies[i].nice - prevCoreJiffies[i].nice;
-            diff.system = newCoreJiffies[i].system - prevCoreJiffies[i].system;
-            diff.idle = newCoreJiffies[i].idle - prevCoreJiffies[i].idle;
-
-            long int total = diff.user + diff.nice + diff.system + diff.idle;
-            if (total > 0)
-            {
-                double idle_ratio = static_cast<double>(diff.idle) / static_cast<double>(total);
-                cpuInfo.cores[i].usage = static_cast<float>(100.0 * (1.0 - idle_ratio));
-            }
-        }
+        cpuInfo.cores[i].id = curJiffies.ids[i + 1];
     }
+    sampleCoreSpeeds();
 
-    prevCoreJiffies = newCoreJiffies;
-    prevJiffies = curJiffies;
-    fclose(pStat);
+    // 초기 상태이거나 온라인 코어 구성이 바뀌었으면 이번 값은 기준값으로만 사용
+    if (prevJiffies.rows == curJiffies.rows && prevJiffies.ids == curJiffies.ids)
+    {
+        computeUsage();
+    }
+    swap(prevJiffies, curJiffies);
 
     // 온도 데이터 캐싱 구현
     unsigned long current_time = static_cast<unsigned long>(time(NULL) * 1000);
@@ -417,21 +440,121 @@ void CPUCollector::collect()
     }
 }
 
+/**
+ * @brief 이전/현재 jiffies 표의 차이로 사용률과 시간 항목별 비율을 계산하는 메서드
+ * @details 열 단위 배열에서 행 방향으로 차이, 합계, 백분율을 차례로 계산하므로
+ *          각 루프는 코어 수만큼 연속된 메모리를 읽고 써서 컴파일러가 벡터화합니다.
+ *          guest와 guest_nice는 user와 nice에 이미 포함되어 있어 합계에서 제외하며,
+ *          사용률은 idle과 iowait를 뺀 비율입니다. 차이가 0인 행은 이전 값을 유지합니다.
+ */
+void CPUCollector::computeUsage()
+{
+    const size_t rows = curJiffies.rows;
+    jiffyDelta.resize(JiffyTable::COLUMNS * rows);
+    jiffyScale.assign(rows, 0.0f);
+
+    for (size_t c = 0; c < JiffyTable::COLUMNS; c++)
+    {
+        const uint64_t *cur = curJiffies.column(c);
+        const uint64_t *prev = prevJiffies.column(c);
+        uint64_t *delta = jiffyDelta.data() + c * rows;
+        for (size_t r = 0; r < rows; r++)
+        {
+            // 코어가 다시 온라인이 되어 카운터가 줄어든 경우는 0으로 처리
+            delta[r] = cur[r] > prev[r] ? cur[r] - prev[r] : 0;
+        }
+    }
+
+    float *scale = jiffyScale.data();
+    for (size_t c = JiffyTable::User; c < JiffyTable::Guest; c++)
+    {
+        const uint64_t *delta = jiffyDelta.data() + c * rows;
+        for (size_t r = 0; r < rows; r++)
+        {
+            scale[r] += static_cast<float>(delta[r]);
+        }
+    }
+    for (size_t r = 0; r < rows; r++)
+    {
+        scale[r] = scale[r] > 0.0f ? 100.0f / scale[r] : 0.0f;
+    }
+
+    auto share = [&](size_t c, size_t r)
+    {
+        return static_cast<float>(jiffyDelta[c * rows + r]) * scale[r];
+    };
+    auto fill = [&](size_t r, float &usage, CpuTimes &times)
+    {
+        if (scale[r] == 0.0f)
+            return;
+
+        times.user = share(JiffyTable::User, r);
+        times.nice = share(JiffyTable::Nice, r);
+        times.system = share(JiffyTable::System, r);
+        times.idle = share(JiffyTable::Idle, r);
+        times.iowait = share(JiffyTable::Iowait, r);
+        times.irq = share(JiffyTable::Irq, r);
+        times.softirq = share(JiffyTable::Softirq, r);
+        times.steal = share(JiffyTable::Steal, r);
+        times.guest = share(JiffyTable::Guest, r);
+        times.guest_nice = share(JiffyTable::GuestNice, r);
+        usage = max(0.0f, 100.0f - times.idle - times.iowait);
+    };
+
+    fill(0, cpuInfo.usage, cpuInfo.times);
+    for (size_t i = 0; i + 1 < rows; i++)
+    {
+        fill(i + 1, cpuInfo.cores[i].usage, cpuInfo.cores[i].times);
+    }
+}
+
+/**
+ * @brief 코어별 현재 클럭 속도를 읽는 메서드
+ * @details 코어 번호(cpuN)마다 scaling_cur_freq를 처음 한 번만 열고 이후에는 pread로 다시 읽습니다.
+ *          cpufreq가 없는 코어(가상 머신 등)는 다시 열지 않고 0을 보고합니다.
+ */
+void CPUCollector::sampleCoreSpeeds()
+{
+    for (CpuCoreInfo &core : cpuInfo.cores)
+    {
+        if (core.id >= curFreqFds.size())
+        {
+            curFreqFds.resize(core.id + 1, FREQ_FD_UNOPENED);
+        }
+
+        int &fd = curFreqFds[core.id];
+        if (fd == FREQ_FD_UNOPENED)
+        {
+            string path = string(CPU_SYSFS_DIR) + "/cpu" + to_string(core.id) + "/cpufreq/scaling_cur_freq";
+            fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        }
+
+        uint64_t khz = 0;
+        core.speed = fd >= 0 && readKhz(fd, khz) ? static_cast<float>(khz) / 1000.0f : 0.0f;
+    }
+}
+
 /**
  * @brief 수집된 CPU 정보를 반환하는 메서드
- * @return CPU 정보 구조체 (CpuInfo)
+ * @return CPU 정보 구조체 (CpuInfo)의 상수 참조
  */
-const CpuInfo CPUCollector::getCpuInfo() const
+const CpuInfo &CPUCollector::getCpuInfo() const
 {
     return cpuInfo;
 }
 
 /**
  * @brief CPUCollector 클래스 소멸자
- * @details libsensors 라이브러리 자원을 정리합니다.
+ * @details 열어 둔 cpufreq fd와 libsensors 라이브러리 자원을 정리합니다.
  */
 CPUCollector::~CPUCollector()
 {
+    for (int fd : curFreqFds)
+    {
+        if (fd >= 0)
+            close(fd);
+    }
+
     if (sensors_initialized)
     {
         sensors_cleanup();
@@ -493,50 +616,40 @@ void CPUCollector::collectCacheInfo()
     }
 }
 
+/**
+ * @brief 최소/최대/기본 클럭 속도를 수집하는 메서드
+ * @details /sys/devices/system/cpu/cpuN/cpufreq의 cpuinfo_min_freq, cpuinfo_max_freq,
+ *          base_frequency를 읽습니다. 외부 명령을 실행하지 않으므로 시작 시간이 짧고 권한이 필요 없습니다.
+ *          기본 주파수를 제공하지 않는 드라이버에서는 /proc/cpuinfo 모델 이름의 표기 속도를 사용합니다.
+ */
 void CPUCollector::getBaseCpuSpeed()
 {
-    // 기존 코드 유지 (min, max MHz 수집)
-    FILE *fp = popen("lscpu | grep 'CPU max MHz\\|CPU min MHz'", "r");
-    if (fp != NULL)
-    {
-        char line[256];
-        while (fgets(line, sizeof(line), fp))
-        {
-            if (strstr(line, "CPU max MHz"))
-            {
-                float mhz;
-                if (sscanf(line, "CPU max MHz: %f", &mhz) == 1)
-                {
-                    cpuInfo.max_clock_speed = mhz;
-                }
-            }
-            else if (strstr(line, "CPU min MHz"))
-            {
-                float mhz;
-                if (sscanf(line, "CPU min MHz: %f", &mhz) == 1)
-                {
-                    cpuInfo.min_clock_speed = mhz;
-                }
-            }
-        }
-        pclose(fp);
-    }
-
-    // 기본 클럭 속도 수집 (dmidecode 사용)
-    FILE *base_fp = popen("sudo dmidecode -t processor | grep 'Current Speed'", "r");
-    if (base_fp != NULL)
+    // cpufreq의 최소/최대 주파수는 lscpu와 같이 모든 CPU 중 가장 낮은/높은 값을 사용
+    // 기본 주파수(base_frequency)는 intel_pstate 등 일부 드라이버만 제공
+    uint64_t min_khz = 0, max_khz = 0, base_khz = 0;
+    DIR *dir = opendir(CPU_SYSFS_DIR);
+    if (dir != NULL)
     {
-        char line[256];
-        if (fgets(line, sizeof(line), base_fp))
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != NULL)
         {
-            float ghz;
-            if (sscanf(line, "Current Speed: %f GHz", &ghz) == 1)
-            {
-                cpuInfo.base_clock_speed = ghz * 1000; // GHz를 MHz로 변환
-            }
+            if (strncmp(entry->d_name, "cpu", 3) != 0 || entry->d_name[3] < '0' || entry->d_name[3] > '9')
+                continue;
+
+            string cpufreq = string(CPU_SYSFS_DIR) + "/" + entry->d_name + "/cpufreq/";
+            uint64_t khz = 0;
+            if (readKhz(cpufreq + "cpuinfo_min_freq", khz) && khz > 0 && (min_khz == 0 || khz < min_khz))
+                min_khz = khz;
+            if (readKhz(cpufreq + "cpuinfo_max_freq", khz) && khz > max_khz)
+                max_khz = khz;
+            if (base_khz == 0 && readKhz(cpufreq + "base_frequency", khz))
+                base_khz = khz;
         }
-        pclose(base_fp);
+        closedir(dir);
     }
+    cpuInfo.min_clock_speed = static_cast<float>(min_khz) / 1000.0f; // kHz를 MHz로 변환
+    cpuInfo.max_clock_speed = static_cast<float>(max_khz) / 1000.0f;
+    cpuInfo.base_clock_speed = static_cast<float>(base_khz) / 1000.0f;
 
     // 백업 방법: base_clock_speed가 설정되지 않았다면 /proc/cpuinfo의 모델 이름에서 추출 시도
     if (cpuInfo.base_clock_speed == 0.0f)
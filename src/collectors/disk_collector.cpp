@@ -6,55 +6,78 @@
 #include <iostream>
 #include <unordered_map>
 #include <vector>
-#include <atomic>
-#include <thread>
 #include <cerrno>
 #include <cstring>
-#include <queue>
 #include <mutex>
-#include <condition_variable>
-#include <functional>
 #include <future>
 #include <set>
+#include <memory>
+#include <algorithm>
 #include "log/logger.h"
 
 using namespace std;
 
+namespace
+{
+    /**
+     * @brief statvfs로 마운트 지점의 사용량 정보를 갱신합니다.
+     *
+     * @param disk_info 갱신할 디스크 정보
+     */
+    void refreshUsage(DiskInfo &disk_info)
+    {
+        struct statvfs fs_stats;
+        if (statvfs(disk_info.mount_point.c_str(), &fs_stats) == 0)
+        {
+            disk_info.total = fs_stats.f_blocks * fs_stats.f_frsize;
+            // 사용 가능한 용량
+            disk_info.free = fs_stats.f_bfree * fs_stats.f_frsize;
+            // 사용중인 용량
+            disk_info.used = disk_info.total - disk_info.free;
+
+            // 사용률 계산 (백분율)
+            if (disk_info.total > 0)
+            {
+                disk_info.usage_percent = (static_cast<float>(disk_info.used) * 100.0f) / static_cast<float>(disk_info.total);
+            }
+            else
+            {
+                disk_info.usage_percent = 0.0;
+            }
+
+            // inode 정보 추가
+            disk_info.inodes_total = fs_stats.f_files;
+            disk_info.inodes_free = fs_stats.f_ffree;
+            disk_info.inodes_used = disk_info.inodes_total - disk_info.inodes_free;
+
+            disk_info.error_flag = false;
+            disk_info.error_message.clear();
+        }
+        else
+        {
+            disk_info.error_flag = true;
+            disk_info.error_message = string("statvfs 오류: ") + strerror(errno);
+        }
+    }
+}
+
 /**
  * @brief DiskCollector 클래스 생성자
  *
- * 스레드 풀을 초기화하고 디스크 정보를 처음으로 수집합니다.
+ * 디스크 정보를 처음으로 수집합니다.
  */
 DiskCollector::DiskCollector() : last_collect_time(chrono::steady_clock::now())
 {
-    // 스레드 풀 초기화
-    for (size_t i = 0; i < THREAD_POOL_SIZE; i++)
-    {
-        thread_pool.emplace_back(&DiskCollector::threadWorker, this);
-    }
-
     collectDiskInfo();
 }
 
 /**
  * @brief DiskCollector 클래스 소멸자
  *
- * 스레드 풀을 정리하고 수집된 디스크 통계 데이터를 삭제합니다.
+ * 수집된 디스크 통계 데이터를 삭제합니다.
  */
 DiskCollector::~DiskCollector()
 {
-    // 스레드 풀 정리
-    stop_threads = true;
-    cv.notify_all();
-
-    for (auto &t : thread_pool)
-    {
-        if (t.joinable())
-        {
-            t.join();
-        }
-    }
-
     disk_stats.clear();
 }
 
@@ -173,96 +196,46 @@ void DiskCollector::collectDiskInfo()
 }
 
 /**
- * @brief 디스크 사용량 정보만 비동기적으로 업데이트합니다.
+ * @brief 디스크 사용량 정보를 병렬로 업데이트합니다.
  *
- * 각 디스크에 대해 비동기 작업을 생성하여 사용량 정보를 수집합니다.
- * 작업에 타임아웃이 적용되며 모든 작업이 완료된 후 I/O 통계 정보도 업데이트합니다.
+ * 각 마운트 지점의 statvfs 호출은 응답하지 않는 네트워크 파일 시스템에서 멈출 수 있으므로
+ * 공유 작업자 풀이 아닌 BlockingPool에서 실행합니다.
+ * 전체 작업에 task_timeout이 적용되며, 시간 내에 끝나지 않은 디스크는 이전 값을 유지한 채
+ * 오류로 표시됩니다. 모든 대기가 끝난 후 I/O 통계 정보도 업데이트합니다.
  */
 void DiskCollector::updateDiskUsage()
 {
-    pending_tasks.clear();
+    auto start_time = chrono::steady_clock::now();
+    auto deadline = start_time + task_timeout;
 
-    // 비동기 작업 결과를 저장할 벡터
-    vector<DiskInfo> updated_stats;
-    mutex update_mutex;
+    // 작업별 결과 슬롯 - 시간 초과된 작업이 나중에 끝나도 안전하도록 작업과 공유
+    auto results = make_shared<vector<DiskInfo>>(disk_stats);
 
-    // 각 디스크에 대해 비동기 작업 생성
-    for (const auto &disk_info : disk_stats)
+    vector<future<void>> tasks;
+    tasks.reserve(results->size());
+    for (size_t i = 0; i < results->size(); i++)
     {
-        // 비동기 태스크 실행 - 값 복사 및 결과 저장
-        future<void> task = async(launch::async, [disk_info, &updated_stats, &update_mutex]()
-                                  {
-            DiskInfo updated_info = disk_info; // 로컬 복사본 생성
-            
-            struct statvfs fs_stats;
-            if (statvfs(updated_info.mount_point.c_str(), &fs_stats) == 0) {
-                // 업데이트된 정보를 로컬 복사본에 저장
-                updated_info.total = fs_stats.f_blocks * fs_stats.f_frsize;
-                // 사용 가능한 용량
-                updated_info.free = fs_stats.f_bfree * fs_stats.f_frsize;
-                // 사용중인 용량
-                updated_info.used = updated_info.total - updated_info.free;
-                
-                // 사용률 계산 (백분율)
-                if (updated_info.total > 0) {
-                    updated_info.usage_percent = (static_cast<float>(updated_info.used) * 100.0f) / static_cast<float>(updated_info.total);
-                } else {
-                    updated_info.usage_percent = 0.0;
-                }
-                
-                // inode 정보 추가
-                updated_info.inodes_total = fs_stats.f_files;
-                updated_info.inodes_free = fs_stats.f_ffree;
-                updated_info.inodes_used = updated_info.inodes_total - updated_info.inodes_free;
-            } else {
-                // 오류 처리
-                updated_info.error_flag = true;
-                updated_info.error_message = string("statvfs 오류: ") + strerror(errno);
-            }
-
-            // 결과를 공유 벡터에 안전하게 추가
-            lock_guard<mutex> lock(update_mutex);
-            updated_stats.push_back(updated_info); });
-
-        pending_tasks.push_back(move(task));
+        tasks.push_back(submitBlockingTask([results, i]()
+                                           { refreshUsage((*results)[i]); }));
     }
 
-    // 모든 비동기 작업 완료 대기 (타임아웃 적용)
-    auto start_time = chrono::steady_clock::now();
-
-    for (auto &task : pending_tasks)
+    for (size_t i = 0; i < tasks.size(); i++)
     {
-        // 각 작업에 타임아웃 적용
-        auto status = task.wait_for(task_timeout);
-
-        if (status != future_status::ready)
+        auto remaining = chrono::duration_cast<chrono::milliseconds>(deadline - chrono::steady_clock::now());
+        if (awaitSubTaskFor(tasks[i], max(remaining, chrono::milliseconds(0))))
         {
-            // 타임아웃 발생 - 로그 기록
-            cerr << "디스크 정보 수집 태스크 타임아웃" << endl;
-            // 작업은 백그라운드에서 계속 실행됨 (리소스 누수 가능성)
+            disk_stats[i] = (*results)[i];
         }
-    }
-
-    // 원본 데이터(disk_stats)에서 복사본(updated_stats)으로 I/O 통계 복사
-    // LOG_INFO("I/O 통계 정보 병합 시작 - 업데이트할 디스크 수: " + to_string(updated_stats.size()));
-    for (auto &updated_info : updated_stats)
-    {
-        // 디스크 이름으로 원본 데이터 찾기
-        for (const auto &original_info : disk_stats)
+        else
         {
-            if (updated_info.device == original_info.device)
-            {
-                // I/O 통계 정보 복사
-                updated_info.io_stats = original_info.io_stats;
-                break;
-            }
+            // 작업은 결과 슬롯을 공유하므로 백그라운드에서 안전하게 마무리됨
+            disk_stats[i].error_flag = true;
+            disk_stats[i].error_message = "statvfs 시간 초과";
+            LOG_WARN("디스크 정보 수집 태스크 타임아웃: {}", disk_stats[i].mount_point);
         }
     }
 
-    // 1. 먼저 disk_stats 업데이트
-    disk_stats = updated_stats;
-
-    // 2. 디스크 단위로 I/O 통계 정보 업데이트
+    // 디스크 단위로 I/O 통계 정보 업데이트
     updateIoStats();
 
     // 성능 측정 로깅
@@ -270,10 +243,8 @@ void DiskCollector::updateDiskUsage()
     auto duration = chrono::duration_cast<chrono::milliseconds>(end_time - start_time);
     if (duration.count() > 100)
     {
-        cerr << "디스크 사용량 정보 수집에 " << duration.count() << "ms 소요됨" << endl;
+        LOG_WARN("디스크 사용량 정보 수집에 {}ms 소요됨", duration.count());
     }
-
-    // LOG_INFO("디스크 정보 업데이트 완료 - 총 디스크 수: " + to_string(disk_stats.size()));
 }
 
 /**
@@ -620,15 +591,10 @@ void DiskCollector::collect()
 /**
  * @brief 수집된 디스크 통계 정보를 반환합니다.
  *
- * @return vector<DiskInfo> 수집된 모든 디스크의 정보
+ * @return const vector<DiskInfo>& 수집된 모든 디스크의 정보의 상수 참조
  */
-vector<DiskInfo> DiskCollector::getDiskStats() const
+const vector<DiskInfo> &DiskCollector::getDiskStats() const
 {
-    // LOG_INFO("getDiskStats 호출");
-    for (const auto &disk : disk_stats)
-    {
-        // LOG_INFO("이름: " + disk.device + " 읽기/초: " + to_string(disk.io_stats.reads_per_sec) + " 쓰기/초: " + to_string(disk.io_stats.writes_per_sec) + " 읽기 바이트/초: " + to_string(disk.io_stats.read_bytes_per_sec) + " 쓰기 바이트/초: " + to_string(disk.io_stats.write_bytes_per_sec));
-    }
     return disk_stats;
 }
 
@@ -664,76 +630,3 @@ bool DiskCollector::detectDiskChanges()
 
     return false;
 }
-
-/**
- * @brief 스레드 풀의 작업자 스레드 함수입니다.
- *
- * 작업 큐에서 태스크를 가져와 실행합니다.
- * 종료 신호가 있거나 작업 큐가 비어있을 때까지 대기합니다.
- */
-void DiskCollector::threadWorker()
-{
-    while (!stop_threads)
-    {
-        function<void()> task;
-        {
-            // 작업 큐에서 태스크 가져오기
-            unique_lock<mutex> lock(queue_mutex);
-            cv.wait(lock, [this]
-                    { return !task_queue.empty() || stop_threads; });
-
-            if (stop_threads && task_queue.empty())
-            {
-                return;
-            }
-
-            if (!task_queue.empty())
-            {
-                task = move(task_queue.front());
-                task_queue.pop();
-                active_tasks++;
-            }
-        }
-
-        // 태스크 실행
-        if (task)
-        {
-            task();
-            active_tasks--;
-        }
-    }
-}
-
-/**
- * @brief 작업 큐에 새 태스크를 추가합니다.
- *
- * @param task 실행할 함수 객체
- */
-void DiskCollector::addTask(function<void()> task)
-{
-    {
-        unique_lock<mutex> lock(queue_mutex);
-        task_queue.push(move(task));
-    }
-    cv.notify_one();
-}
-
-/**
- * @brief 모든 작업이 완료될 때까지 대기합니다.
- *
- * 작업 큐가 비어있고 현재 실행 중인 작업이 없을 때까지 대기합니다.
- */
-void DiskCollector::waitForTasks()
-{
-    while (true)
-    {
-        {
-            unique_lock<mutex> lock(queue_mutex);
-            if (task_queue.empty() && active_tasks == 0)
-            {
-                break;
-            }
-        }
-        this_thread::sleep_for(chrono::milliseconds(10));
-    }
-}
\ No newline at end of file
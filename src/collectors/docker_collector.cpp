@@ -217,15 +217,16 @@ void DockerCollector::collect()
 
                 if (useCache)
                 {
-                    // 캐시된 정보 사용
-                    futures.push_back(async(launch::async, [cachedInfo]()
-                                            { return cachedInfo; }));
+                    // 캐시된 정보 사용 - 작업 없이 완료된 future로 전달
+                    promise<DockerContainerInfo> cached;
+                    cached.set_value(cachedInfo);
+                    futures.push_back(cached.get_future());
                     continue;
                 }
 
-                // 컨테이너 정보 처리를 비동기로 실행
-                futures.push_back(async(launch::async, [this, container, containerId, now]()
-                                        {
+                // 컨테이너 정보 처리를 공유 작업자 풀에서 실행
+                futures.push_back(submitSubTask([this, container, containerId, now]()
+                                                {
                     try
                     {
                         DockerContainerInfo info;
@@ -703,7 +704,7 @@ void DockerCollector::collect()
             // 모든 비동기 작업 결과 수집
             for (auto &f : futures)
             {
-                DockerContainerInfo info = f.get();
+                DockerContainerInfo info = awaitSubTask(f);
                 if (!info.container_name.empty() && info.container_name != "Unknown") // 유효한 컨테이너 정보만 추가
                 {
                     localcontainers.push_back(info);
@@ -738,4 +739,17 @@ vector<DockerContainerInfo> DockerCollector::getContainers() const
 {
     lock_guard<mutex> lock(containersMutex);
     return containers;
+}
+
+/**
+ * @brief 수집된 컨테이너 정보를 기존 벡터에 채웁니다
+ *
+ * 복사 대입을 사용하므로 out이 이전에 할당한 버퍼가 재사용됩니다.
+ *
+ * @param out 결과를 채울 벡터
+ */
+void DockerCollector::getContainers(vector<DockerContainerInfo> &out) const
+{
+    lock_guard<mutex> lock(containersMutex);
+    out = containers;
 }
\ No newline at end of file
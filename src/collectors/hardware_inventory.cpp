@@ -0,0 +1,219 @@
+/**
+ * @file hardware_inventory.cpp
+ * @brief SMBIOS DMI 테이블 기반 하드웨어 인벤토리 구현
+ */
+
+#include "collectors/hardware_inventory.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+#include "log/logger.h"
+
+using namespace std;
+
+namespace
+{
+    /**
+     * @brief 커널이 노출하는 SMBIOS 구조체 테이블 경로
+     */
+    constexpr const char *DMI_TABLE_PATH = "/sys/firmware/dmi/tables/DMI";
+
+    constexpr uint8_t SMBIOS_MEMORY_DEVICE = 17; ///< Memory Device 구조체 타입
+    constexpr uint8_t SMBIOS_END_OF_TABLE = 127; ///< End-of-Table 구조체 타입
+
+    /**
+     * @brief 리틀 엔디언 WORD 읽기
+     */
+    uint16_t readWord(const uint8_t *p)
+    {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    /**
+     * @brief 리틀 엔디언 DWORD 읽기
+     */
+    uint32_t readDword(const uint8_t *p)
+    {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    /**
+     * @brief Memory Device Form Factor 값을 dmidecode와 같은 이름으로 변환
+     *
+     * @param value Form Factor 필드 값
+     * @return const char* 형식 이름 (범위를 벗어나면 "Etc")
+     */
+    const char *formFactorName(uint8_t value)
+    {
+        static const char *const names[] = {
+            "Other", "Unknown", "SIMM", "SIP", "Chip", "DIP", "ZIP", "Proprietary Card",
+            "DIMM", "TSOP", "Row Of Chips", "RIMM", "SODIMM", "SRIMM", "FB-DIMM", "Die"};
+        if (value == 0 || value > sizeof(names) / sizeof(names[0]))
+            return "Etc";
+        return names[value - 1];
+    }
+
+    /**
+     * @brief 파일 전체를 읽기
+     *
+     * @param path 파일 경로
+     * @param data 읽은 내용
+     * @return bool 성공하면 true (errno 유지)
+     */
+    bool readFile(const char *path, vector<uint8_t> &data)
+    {
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+
+        data.clear();
+        uint8_t buffer[8192];
+        ssize_t n;
+        while ((n = read(fd, buffer, sizeof(buffer))) > 0)
+        {
+            data.insert(data.end(), buffer, buffer + n);
+        }
+        int saved = errno;
+        close(fd);
+        errno = saved;
+        return n == 0;
+    }
+}
+
+/**
+ * @brief 전역 인벤토리 인스턴스 반환
+ *
+ * @return HardwareInventory& 인벤토리 인스턴스
+ */
+HardwareInventory &HardwareInventory::instance()
+{
+    static HardwareInventory inventory;
+    return inventory;
+}
+
+/**
+ * @brief 메모리 모듈 구성 정보 반환
+ *
+ * 처음 호출될 때만 DMI 테이블을 읽고 이후에는 보관된 사본을 돌려줍니다.
+ * 읽기에 실패해도 다시 시도하지 않으며, refresh()로만 다시 읽습니다.
+ *
+ * @return MemoryInventory 메모리 모듈 구성 정보 사본
+ */
+MemoryInventory HardwareInventory::memory()
+{
+    lock_guard<mutex> lock(mutex_);
+    if (!loaded_)
+    {
+        parseMemory(DMI_TABLE_PATH, memory_);
+        loaded_ = true;
+    }
+    return memory_;
+}
+
+/**
+ * @brief DMI 테이블을 다시 읽어 보관된 정보를 갱신
+ *
+ * @return bool DMI 테이블을 읽었으면 true
+ */
+bool HardwareInventory::refresh()
+{
+    MemoryInventory fresh;
+    bool ok = parseMemory(DMI_TABLE_PATH, fresh);
+
+    lock_guard<mutex> lock(mutex_);
+    memory_ = move(fresh);
+    loaded_ = true;
+    return ok;
+}
+
+/**
+ * @brief DMI 테이블에서 메모리 모듈 정보를 파싱
+ *
+ * SMBIOS 구조체는 4바이트 헤더(타입, 길이, 핸들)와 서식 영역, 이중 NUL로 끝나는 문자열 집합으로
+ * 이루어집니다. Memory Device(Type 17)마다 슬롯 하나로 세고, Size가 0(미장착)이나 0xFFFF(알 수 없음)가
+ * 아니면 장착된 슬롯으로 셉니다. 속도는 장착된 모듈의 Speed(0xFFFF면 Extended Speed) 평균이며,
+ * 폼 팩터는 첫 번째 Memory Device의 값을 사용합니다.
+ *
+ * @param path SMBIOS 구조체 테이블 경로
+ * @param out 파싱 결과 (실패 시 기본값)
+ * @return bool 테이블을 읽었으면 true
+ */
+bool HardwareInventory::parseMemory(const char *path, MemoryInventory &out)
+{
+    out = MemoryInventory();
+
+    vector<uint8_t> table;
+    if (!readFile(path, table))
+    {
+        LOG_WARN("DMI 테이블을 읽을 수 없어 메모리 모듈 정보를 생략합니다 ({}): {}", path, strerror(errno));
+        return false;
+    }
+
+    const uint8_t *data = table.data();
+    const size_t size = table.size();
+    uint64_t speed_sum = 0;
+    uint64_t speed_count = 0;
+    bool first_device = true;
+
+    size_t offset = 0;
+    while (offset + 4 <= size)
+    {
+        const uint8_t *header = data + offset;
+        const uint8_t type = header[0];
+        const uint8_t length = header[1];
+        if (length < 4 || offset + length > size)
+        {
+            break;
+        }
+
+        if (type == SMBIOS_MEMORY_DEVICE)
+        {
+            out.total_slot_count++;
+
+            if (first_device && length > 0x0E)
+            {
+                out.form_factor = formFactorName(header[0x0E]);
+            }
+            first_device = false;
+
+            uint16_t module_size = length >= 0x0E ? readWord(header + 0x0C) : 0;
+            if (module_size != 0 && module_size != 0xFFFF)
+            {
+                out.using_slot_count++;
+
+                uint32_t speed = length >= 0x17 ? readWord(header + 0x15) : 0;
+                if (speed == 0xFFFF)
+                {
+                    speed = length >= 0x58 ? readDword(header + 0x54) : 0;
+                }
+                if (speed != 0 && speed != 0xFFFF)
+                {
+                    speed_sum += speed;
+                    speed_count++;
+                }
+            }
+        }
+        else if (type == SMBIOS_END_OF_TABLE)
+        {
+            break;
+        }
+
+        // 서식 영역 뒤의 문자열 집합(이중 NUL로 끝남)을 건너뜀
+        size_t next = offset + length;
+        while (next + 1 < size && (data[next] != 0 || data[next + 1] != 0))
+        {
+            next++;
+        }
+        offset = next + 2;
+    }
+
+    if (speed_count > 0)
+    {
+        out.data_rate = speed_sum / speed_count;
+    }
+    return true;
+}
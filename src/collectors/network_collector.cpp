@@ -330,6 +330,25 @@ vector<NetworkInterface> NetworkCollector::getInterfacesToVector() const
     return result;
 }
 
+/**
+ * @brief 저장된 인터페이스 정보를 기존 벡터에 채웁니다.
+ *
+ * 요소를 새로 만들지 않고 복사 대입하므로 이전 주기에 할당된
+ * 벡터와 문자열 버퍼가 그대로 재사용됩니다.
+ *
+ * @param out 결과를 채울 벡터
+ */
+void NetworkCollector::getInterfacesToVector(vector<NetworkInterface> &out) const
+{
+    out.resize(interfaces.size());
+
+    size_t i = 0;
+    for (const auto &pair : interfaces)
+    {
+        out[i++] = pair.second;
+    }
+}
+
 /**
  * @brief 지정된 네트워크 인터페이스의 연결 타입을 반환합니다.
  * @param if_name 네트워크 인터페이스 이름
@@ -0,0 +1,253 @@
+/**
+ * @file pressure_collector.cpp
+ * @brief 자원 압력(PSI)과 CPU 실행 대기 시간을 수집하는 PressureCollector 클래스의 구현
+ */
+#include "collectors/pressure_collector.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+namespace
+{
+    /**
+     * @brief cpu 줄의 레이아웃이 지금과 같은 가장 오래된 /proc/schedstat 버전
+     */
+    constexpr uint64_t MIN_SCHEDSTAT_VERSION = 15;
+
+    /**
+     * @brief /proc/schedstat cpu 줄의 숫자 열 수
+     */
+    constexpr size_t SCHEDSTAT_CPU_FIELDS = 9;
+
+    /**
+     * @brief 코어마다 보관하는 누적 값 수 (run_time, wait_time, timeslices)
+     */
+    constexpr size_t SCHED_VALUES = 3;
+
+    /**
+     * @brief "12.34" 형식의 소수를 파싱
+     *
+     * @param p 파싱 시작 위치
+     * @param end 텍스트 끝
+     * @param value 파싱한 값
+     * @return const char* 숫자 바로 뒤 위치
+     */
+    const char *parseDecimal(const char *p, const char *end, float &value)
+    {
+        uint64_t integer = 0;
+        p = ProcFile::parseUnsigned(p, end, integer);
+        value = static_cast<float>(integer);
+
+        if (p < end && *p == '.')
+        {
+            float scale = 0.1f;
+            for (p++; p < end && *p >= '0' && *p <= '9'; p++)
+            {
+                value += static_cast<float>(*p - '0') * scale;
+                scale *= 0.1f;
+            }
+        }
+        return p;
+    }
+
+    /**
+     * @brief 다음 줄의 끝 위치 반환
+     */
+    const char *lineEnd(const char *p, const char *end)
+    {
+        const char *eol = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+        return eol ? eol : end;
+    }
+
+    /**
+     * @brief PSI 한 줄("avg10=0.00 avg60=0.00 avg300=0.00 total=0")을 파싱하고 차이를 계산
+     *
+     * @param p "some " 또는 "full " 바로 뒤 위치
+     * @param end 줄 끝
+     * @param stat 갱신할 값
+     * @param elapsedUs 직전 수집 이후 경과 시간 (마이크로초, 첫 수집이면 0)
+     */
+    void parsePressureLine(const char *p, const char *end, PressureStat &stat, double elapsedUs)
+    {
+        const uint64_t previous = stat.total;
+        uint64_t total = previous;
+
+        while (p < end)
+        {
+            while (p < end && *p == ' ')
+                p++;
+            const char *eq = static_cast<const char *>(memchr(p, '=', static_cast<size_t>(end - p)));
+            if (!eq)
+                break;
+
+            string_view key(p, static_cast<size_t>(eq - p));
+            p = eq + 1;
+            if (key == "avg10")
+                p = parseDecimal(p, end, stat.avg10);
+            else if (key == "avg60")
+                p = parseDecimal(p, end, stat.avg60);
+            else if (key == "avg300")
+                p = parseDecimal(p, end, stat.avg300);
+            else if (key == "total")
+                p = ProcFile::parseUnsigned(p, end, total);
+
+            while (p < end && *p != ' ')
+                p++;
+        }
+
+        stat.total = total;
+        stat.delta = elapsedUs > 0.0 && total >= previous ? total - previous : 0;
+        stat.stall_percent = elapsedUs > 0.0
+                                 ? min(100.0f, static_cast<float>(static_cast<double>(stat.delta) / elapsedUs * 100.0))
+                                 : 0.0f;
+    }
+}
+
+/**
+ * @brief 압력 정보를 수집합니다.
+ *
+ * 세 PSI 파일 중 하나라도 읽을 수 있으면 available을 true로 설정하고,
+ * 이어서 /proc/schedstat의 코어별 실행/대기 시간 차이를 계산합니다.
+ */
+void PressureCollector::collect()
+{
+    auto now = chrono::steady_clock::now();
+    double elapsedNs = hasPrevious ? chrono::duration<double, nano>(now - lastCollectTime).count() : 0.0;
+
+    bool cpu = readPressure(cpuPressure, pressureInfo.cpu, elapsedNs / 1000.0);
+    bool memory = readPressure(memoryPressure, pressureInfo.memory, elapsedNs / 1000.0);
+    bool io = readPressure(ioPressure, pressureInfo.io, elapsedNs / 1000.0);
+    pressureInfo.available = cpu || memory || io;
+
+    readSchedstat(elapsedNs);
+
+    lastCollectTime = now;
+    hasPrevious = true;
+}
+
+/**
+ * @brief PSI 파일 하나를 읽어 some/full 값과 차이를 갱신
+ *
+ * @param file PSI 파일 리더
+ * @param pressure 갱신할 압력 정보
+ * @param elapsedUs 직전 수집 이후 경과 시간 (마이크로초, 첫 수집이면 0)
+ * @return bool 파일을 읽었으면 true
+ */
+bool PressureCollector::readPressure(ProcFile &file, ResourcePressure &pressure, double elapsedUs)
+{
+    if (!file.read())
+    {
+        return false;
+    }
+
+    string_view text = file.contents();
+    const char *p = text.data();
+    const char *end = p + text.size();
+    while (p < end)
+    {
+        const char *eol = lineEnd(p, end);
+        string_view line(p, static_cast<size_t>(eol - p));
+
+        if (line.compare(0, 5, "some ") == 0)
+            parsePressureLine(p + 5, eol, pressure.some, elapsedUs);
+        else if (line.compare(0, 5, "full ") == 0)
+            parsePressureLine(p + 5, eol, pressure.full, elapsedUs);
+
+        p = eol + 1;
+    }
+    return true;
+}
+
+/**
+ * @brief /proc/schedstat의 cpu 줄을 읽어 코어별 실행/대기 시간 차이를 갱신
+ *
+ * cpu 줄의 7~9번째 열은 각각 누적 실행 시간(ns), 실행 큐 대기 시간(ns), 타임슬라이스 수입니다.
+ * 직전 수집과 같은 행에 같은 CPU가 있을 때만 차이를 계산하므로 CPU 핫플러그 직후 한 주기는 0입니다.
+ *
+ * @param elapsedNs 직전 수집 이후 경과 시간 (나노초, 첫 수집이면 0)
+ */
+void PressureCollector::readSchedstat(double elapsedNs)
+{
+    vector<SchedCoreInfo> &cores = pressureInfo.cores;
+    if (!schedstat.read())
+    {
+        cores.clear();
+        prevSched.clear();
+        return;
+    }
+
+    string_view text = schedstat.contents();
+    const char *p = text.data();
+    const char *end = p + text.size();
+    const size_t prevRows = prevSched.size() / SCHED_VALUES;
+    size_t row = 0;
+
+    while (p < end)
+    {
+        const char *eol = lineEnd(p, end);
+        string_view line(p, static_cast<size_t>(eol - p));
+
+        if (line.compare(0, 8, "version ") == 0)
+        {
+            uint64_t version = 0;
+            ProcFile::parseUnsigned(p + 8, eol, version);
+            if (version < MIN_SCHEDSTAT_VERSION)
+            {
+                break;
+            }
+        }
+        else if (line.size() > 3 && line.compare(0, 3, "cpu") == 0)
+        {
+            uint64_t id = 0;
+            uint64_t fields[SCHEDSTAT_CPU_FIELDS] = {};
+            const char *q = ProcFile::parseUnsigned(p + 3, eol, id);
+            for (uint64_t &field : fields)
+            {
+                q = ProcFile::parseUnsigned(q, eol, field);
+            }
+
+            if (row >= cores.size())
+            {
+                cores.emplace_back();
+            }
+            if (prevSched.size() < (row + 1) * SCHED_VALUES)
+            {
+                prevSched.resize((row + 1) * SCHED_VALUES);
+            }
+
+            SchedCoreInfo &core = cores[row];
+            uint64_t *previous = prevSched.data() + row * SCHED_VALUES;
+            const uint64_t current[SCHED_VALUES] = {fields[6], fields[7], fields[8]};
+            const bool comparable = elapsedNs > 0.0 && row < prevRows && core.id == id;
+
+            auto delta = [&](size_t i)
+            {
+                return comparable && current[i] >= previous[i] ? current[i] - previous[i] : 0;
+            };
+            core.id = static_cast<size_t>(id);
+            core.run_time = delta(0);
+            core.wait_time = delta(1);
+            core.timeslices = delta(2);
+            core.wait_ratio = comparable ? static_cast<float>(static_cast<double>(core.wait_time) / elapsedNs) : 0.0f;
+
+            copy(current, current + SCHED_VALUES, previous);
+            row++;
+        }
+
+        p = eol + 1;
+    }
+
+    cores.resize(row);
+    prevSched.resize(row * SCHED_VALUES);
+}
+
+/**
+ * @brief 수집된 압력 정보를 반환합니다.
+ *
+ * @return const PressureInfo& 수집된 압력 정보의 상수 참조
+ */
+const PressureInfo &PressureCollector::getPressureInfo() const
+{
+    return pressureInfo;
+}
@@ -0,0 +1,332 @@
+/**
+ * @file proc_connector.cpp
+ * @brief netlink 프로세스 커넥터 리스너 구현
+ */
+#include "collectors/proc_connector.h"
+#include "log/logger.h"
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/connector.h>
+#include <linux/cn_proc.h>
+
+using namespace std;
+
+namespace
+{
+    /**
+     * @brief 중지 플래그를 확인하는 수신 대기 간격 (밀리초)
+     */
+    constexpr int POLL_TIMEOUT_MS = 500;
+
+    /**
+     * @brief 이벤트가 몰릴 때 유실을 줄이기 위한 소켓 수신 버퍼 크기
+     */
+    constexpr int RECEIVE_BUFFER_BYTES = 1 << 20;
+
+    /**
+     * @brief /proc/[pid]/comm을 읽음
+     *
+     * @param pid 프로세스 ID
+     * @return string 프로세스 이름 (읽을 수 없으면 빈 문자열)
+     */
+    string readComm(pid_t pid)
+    {
+        char path[32];
+        snprintf(path, sizeof(path), "/proc/%d/comm", static_cast<int>(pid));
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return string();
+
+        char buffer[64];
+        ssize_t n = read(fd, buffer, sizeof(buffer));
+        close(fd);
+        if (n <= 0)
+            return string();
+
+        size_t length = static_cast<size_t>(n);
+        if (buffer[length - 1] == '\n')
+            length--;
+        return string(buffer, length);
+    }
+}
+
+/**
+ * @brief 리스너 생성자
+ *
+ * @param capacity 보관할 최대 이벤트 수
+ */
+ProcConnector::ProcConnector(size_t capacity) : socket_(-1), ring_(capacity > 0 ? capacity : 1)
+{
+}
+
+/**
+ * @brief 리스너 소멸자
+ */
+ProcConnector::~ProcConnector()
+{
+    stop();
+}
+
+/**
+ * @brief 커넥터를 구독하고 수신 스레드를 시작합니다.
+ *
+ * CN_IDX_PROC 그룹에 바인드한 뒤 PROC_CN_MCAST_LISTEN을 보내 이벤트 전송을 요청합니다.
+ * 그룹 바인드는 CAP_NET_ADMIN이 없으면 EPERM으로 실패합니다.
+ *
+ * @return bool 구독에 성공했으면 true
+ */
+bool ProcConnector::start()
+{
+    if (active())
+        return true;
+
+    socket_ = socket(PF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_CONNECTOR);
+    if (socket_ < 0)
+    {
+        LOG_WARN("프로세스 이벤트 소켓 생성 실패, 주기적 폴링으로 동작합니다: {}", strerror(errno));
+        return false;
+    }
+
+    int bufferBytes = RECEIVE_BUFFER_BYTES;
+    setsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &bufferBytes, sizeof(bufferBytes));
+
+    sockaddr_nl address{};
+    address.nl_family = AF_NETLINK;
+    address.nl_groups = CN_IDX_PROC;
+    address.nl_pid = 0;
+
+    // nlmsghdr + cn_msg + proc_cn_mcast_op (cn_msg는 가변 길이 배열로 끝나므로 버퍼에 직접 배치)
+    alignas(nlmsghdr) char request[NLMSG_SPACE(sizeof(cn_msg) + sizeof(proc_cn_mcast_op))] = {};
+    auto *header = reinterpret_cast<nlmsghdr *>(request);
+    header->nlmsg_len = NLMSG_LENGTH(sizeof(cn_msg) + sizeof(proc_cn_mcast_op));
+    header->nlmsg_type = NLMSG_DONE;
+    header->nlmsg_pid = static_cast<__u32>(getpid());
+    auto *message = reinterpret_cast<cn_msg *>(NLMSG_DATA(header));
+    message->id.idx = CN_IDX_PROC;
+    message->id.val = CN_VAL_PROC;
+    message->len = sizeof(proc_cn_mcast_op);
+    proc_cn_mcast_op op = PROC_CN_MCAST_LISTEN;
+    memcpy(message->data, &op, sizeof(op));
+
+    if (bind(socket_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 ||
+        send(socket_, request, header->nlmsg_len, 0) < 0)
+    {
+        LOG_WARN("프로세스 이벤트 구독 실패 (CAP_NET_ADMIN 필요), 주기적 폴링으로 동작합니다: {}", strerror(errno));
+        close(socket_);
+        socket_ = -1;
+        return false;
+    }
+
+    stop_ = false;
+    active_ = true;
+    thread_ = thread(&ProcConnector::run, this);
+    LOG_INFO("프로세스 이벤트 수신 시작");
+    return true;
+}
+
+/**
+ * @brief 수신 스레드를 멈추고 소켓을 닫습니다.
+ */
+void ProcConnector::stop()
+{
+    stop_ = true;
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+    if (socket_ >= 0)
+    {
+        close(socket_);
+        socket_ = -1;
+    }
+    active_ = false;
+}
+
+/**
+ * @brief 마지막 호출 이후 기록된 이벤트를 오래된 순으로 꺼냅니다.
+ *
+ * @param events 결과를 채울 벡터
+ */
+void ProcConnector::drainEvents(vector<ProcessEventInfo> &events)
+{
+    events.clear();
+    lock_guard<mutex> lock(mutex_);
+    events.reserve(count_);
+    size_t start = (head_ + ring_.size() - count_) % ring_.size();
+    for (size_t i = 0; i < count_; i++)
+    {
+        events.push_back(move(ring_[(start + i) % ring_.size()]));
+    }
+    count_ = 0;
+}
+
+/**
+ * @brief 마지막 호출 이후 새로 생긴 프로세스의 PID를 꺼냅니다.
+ *
+ * @param pids 결과를 채울 벡터
+ * @return bool 이벤트를 빠짐없이 받았으면 true
+ */
+bool ProcConnector::drainNewPids(vector<pid_t> &pids)
+{
+    pids.clear();
+    lock_guard<mutex> lock(mutex_);
+    pids.swap(newPids_);
+    bool complete = !lost_ && active();
+    lost_ = false;
+    return complete;
+}
+
+/**
+ * @brief 수신 스레드 본체
+ *
+ * 중지 플래그를 확인할 수 있도록 poll로 대기하며, 소켓 버퍼 초과(ENOBUFS)는
+ * 이벤트 유실로 기록해 다음 수집에서 /proc 전체를 다시 읽게 합니다.
+ */
+void ProcConnector::run()
+{
+    alignas(nlmsghdr) char buffer[8192];
+    pollfd descriptor{socket_, POLLIN, 0};
+
+    while (!stop_)
+    {
+        int ready = poll(&descriptor, 1, POLL_TIMEOUT_MS);
+        if (ready <= 0)
+        {
+            if (ready < 0 && errno != EINTR)
+                break;
+            continue;
+        }
+
+        ssize_t length = recv(socket_, buffer, sizeof(buffer), 0);
+        if (length < 0)
+        {
+            if (errno == ENOBUFS)
+            {
+                lock_guard<mutex> lock(mutex_);
+                lost_ = true;
+                continue;
+            }
+            if (errno == EINTR || errno == EAGAIN)
+                continue;
+            LOG_WARN("프로세스 이벤트 수신 오류, 주기적 폴링으로 전환합니다: {}", strerror(errno));
+            break;
+        }
+        handleMessage(buffer, static_cast<size_t>(length));
+    }
+    active_ = false;
+}
+
+/**
+ * @brief 수신한 netlink 메시지 하나를 처리합니다.
+ *
+ * 스레드 그룹 리더(프로세스)의 fork, exec, exit만 기록하며,
+ * 생성 시각과 exec 시점의 이름을 보관해 종료 시 실행 시간과 이름을 채웁니다.
+ *
+ * @param data 메시지 버퍼
+ * @param length 메시지 길이
+ */
+void ProcConnector::handleMessage(const char *data, size_t length)
+{
+    int remaining = static_cast<int>(length);
+    for (auto *header = reinterpret_cast<const nlmsghdr *>(data); NLMSG_OK(header, remaining);
+         header = NLMSG_NEXT(header, remaining))
+    {
+        if (header->nlmsg_type == NLMSG_ERROR || header->nlmsg_type == NLMSG_NOOP)
+            continue;
+
+        auto *message = reinterpret_cast<const cn_msg *>(NLMSG_DATA(header));
+        if (message->id.idx != CN_IDX_PROC || message->id.val != CN_VAL_PROC)
+            continue;
+
+        auto *event = reinterpret_cast<const proc_event *>(message->data);
+        ProcessEventInfo info;
+        info.time = time(nullptr);
+
+        switch (event->what)
+        {
+        case proc_event::PROC_EVENT_FORK:
+        {
+            const auto &fork = event->event_data.fork;
+            if (fork.child_pid != fork.child_tgid)
+                continue;
+            info.type = "fork";
+            info.pid = fork.child_tgid;
+            info.ppid = fork.parent_tgid;
+
+            if (started_.size() >= MAX_TRACKED)
+                started_.clear();
+            Started &started = started_[info.pid];
+            started.timestampNs = event->timestamp_ns;
+            auto parent = started_.find(info.ppid);
+            started.name = parent != started_.end() ? parent->second.name : string();
+            info.name = started.name;
+
+            lock_guard<mutex> lock(mutex_);
+            newPids_.push_back(info.pid);
+            break;
+        }
+        case proc_event::PROC_EVENT_EXEC:
+        {
+            info.type = "exec";
+            info.pid = event->event_data.exec.process_tgid;
+            info.name = readComm(info.pid);
+            auto it = started_.find(info.pid);
+            if (it != started_.end())
+                it->second.name = info.name;
+            break;
+        }
+        case proc_event::PROC_EVENT_EXIT:
+        {
+            const auto &exit = event->event_data.exit;
+            if (exit.process_pid != exit.process_tgid)
+                continue;
+            info.type = "exit";
+            info.pid = exit.process_tgid;
+
+            // exit_code는 wait() 상태 값 형식 (하위 7비트: 시그널, 8~15비트: 종료 코드)
+            unsigned status = exit.exit_code;
+            if ((status & 0x7f) == 0)
+                info.exit_code = static_cast<int>((status >> 8) & 0xff);
+            else
+                info.exit_signal = static_cast<int>(status & 0x7f);
+
+            auto it = started_.find(info.pid);
+            if (it != started_.end())
+            {
+                info.name = move(it->second.name);
+                info.runtime = static_cast<double>(event->timestamp_ns - it->second.timestampNs) / 1e9;
+                started_.erase(it);
+            }
+            break;
+        }
+        default:
+            continue;
+        }
+
+        record(move(info));
+    }
+}
+
+/**
+ * @brief 이벤트를 링 버퍼에 기록합니다.
+ *
+ * 가득 찼으면 가장 오래된 이벤트를 덮어쓰고 덮어쓴 수를 셉니다.
+ *
+ * @param event 기록할 이벤트
+ */
+void ProcConnector::record(ProcessEventInfo &&event)
+{
+    lock_guard<mutex> lock(mutex_);
+    ring_[head_] = move(event);
+    head_ = (head_ + 1) % ring_.size();
+    if (count_ < ring_.size())
+        count_++;
+    else
+        dropped_.fetch_add(1, memory_order_relaxed);
+}
@@ -0,0 +1,615 @@
+/**
+ * @file proc_pid_reader.cpp
+ * @brief /proc/[pid] 파일을 직접 읽어 파싱하는 프로세스 정보 리더 구현
+ *
+ * 각 파일은 openat으로 프로세스 디렉토리 기준으로 열고 pread로 리더의 버퍼에 통째로 읽은 뒤,
+ * 스트림이나 문자열 변환 없이 버퍼 위에서 바로 정수를 파싱합니다.
+ */
+#include "collectors/proc_pid_reader.h"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <dirent.h>
+#include <string_view>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace
+{
+    /**
+     * @brief 파일 읽기 버퍼의 초기 크기 (대부분의 stat, statm, cmdline이 한 번에 들어감)
+     */
+    constexpr size_t INITIAL_BUFFER_SIZE = 4096;
+
+    /**
+     * @brief getdents64가 반환하는 디렉토리 항목 헤더 (이름은 가변 길이로 뒤따름)
+     */
+    struct LinuxDirent64
+    {
+        uint64_t d_ino;          ///< inode 번호
+        int64_t d_off;           ///< 다음 항목 오프셋
+        unsigned short d_reclen; ///< 이 항목의 전체 길이
+        unsigned char d_type;    ///< 파일 유형
+        char d_name[1];          ///< NUL로 끝나는 이름
+    };
+
+    /**
+     * @brief 공백을 건너뜀
+     *
+     * @param p 현재 위치 (이동됨)
+     * @param end 버퍼 끝
+     */
+    void skipSpaces(const char *&p, const char *end)
+    {
+        while (p < end && *p == ' ')
+            p++;
+    }
+
+    /**
+     * @brief 공백으로 구분된 필드를 지정한 개수만큼 건너뜀
+     *
+     * @param p 현재 위치 (이동됨)
+     * @param end 버퍼 끝
+     * @param count 건너뛸 필드 수
+     * @return bool 필드가 충분했으면 true
+     */
+    bool skipFields(const char *&p, const char *end, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            skipSpaces(p, end);
+            if (p == end)
+                return false;
+            while (p < end && *p != ' ')
+                p++;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 부호 없는 10진 정수를 파싱
+     *
+     * @param p 현재 위치 (이동됨)
+     * @param end 버퍼 끝
+     * @param value 파싱한 값
+     * @return bool 숫자가 있었으면 true
+     */
+    bool parseUnsigned(const char *&p, const char *end, unsigned long long &value)
+    {
+        skipSpaces(p, end);
+        if (p == end || *p < '0' || *p > '9')
+            return false;
+
+        unsigned long long result = 0;
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            result = result * 10 + static_cast<unsigned long long>(*p - '0');
+            p++;
+        }
+        value = result;
+        return true;
+    }
+
+    /**
+     * @brief 부호 있는 10진 정수를 파싱
+     *
+     * @param p 현재 위치 (이동됨)
+     * @param end 버퍼 끝
+     * @param value 파싱한 값
+     * @return bool 숫자가 있었으면 true
+     */
+    bool parseSigned(const char *&p, const char *end, long long &value)
+    {
+        skipSpaces(p, end);
+        bool negative = p < end && *p == '-';
+        if (negative)
+            p++;
+
+        unsigned long long magnitude = 0;
+        if (!parseUnsigned(p, end, magnitude))
+            return false;
+        value = negative ? -static_cast<long long>(magnitude) : static_cast<long long>(magnitude);
+        return true;
+    }
+
+    /**
+     * @brief 디렉토리 이름이 PID(숫자로만 구성)인지 확인하고 값을 반환
+     *
+     * @param name 디렉토리 이름
+     * @param pid 파싱한 PID
+     * @return bool PID 디렉토리이면 true
+     */
+    bool parsePidName(const char *name, pid_t &pid)
+    {
+        const char *p = name;
+        const char *end = name + strlen(name);
+        unsigned long long value = 0;
+        if (!parseUnsigned(p, end, value) || p != end)
+            return false;
+        pid = static_cast<pid_t>(value);
+        return true;
+    }
+}
+
+/**
+ * @brief 리더 생성자
+ *
+ * PID 지정 읽기는 openat으로 이 디렉토리 기준 경로를 열므로 /proc를 한 번만 엽니다.
+ */
+ProcPidReader::ProcPidReader()
+    : procFd_(::open("/proc", O_RDONLY | O_DIRECTORY | O_CLOEXEC)), buffer_(INITIAL_BUFFER_SIZE)
+{
+    long pageSize = sysconf(_SC_PAGESIZE);
+    pageSize_ = pageSize > 0 ? static_cast<uint64_t>(pageSize) : 4096;
+}
+
+/**
+ * @brief 리더 소멸자 - 열린 /proc 디렉토리를 닫습니다.
+ */
+ProcPidReader::~ProcPidReader()
+{
+    if (procFd_ >= 0)
+    {
+        ::close(procFd_);
+    }
+}
+
+/**
+ * @brief 현재 존재하는 모든 프로세스의 PID 목록을 읽습니다.
+ *
+ * @param pids 결과를 채울 벡터 (기존 내용은 지워지고 용량은 재사용)
+ * @return bool /proc를 읽을 수 있으면 true
+ */
+bool ProcPidReader::listPids(vector<pid_t> &pids)
+{
+    pids.clear();
+    DIR *dir = opendir("/proc");
+    if (!dir)
+        return false;
+
+    while (dirent *entry = readdir(dir))
+    {
+        pid_t pid = 0;
+        if (parsePidName(entry->d_name, pid))
+        {
+            pids.push_back(pid);
+        }
+    }
+    closedir(dir);
+    return true;
+}
+
+/**
+ * @brief 프로세스에 속한 스레드(태스크) ID 목록을 읽습니다.
+ *
+ * @param pid 프로세스 ID
+ * @param tids 결과를 채울 벡터
+ * @return bool /proc/[pid]/task를 읽을 수 있으면 true
+ */
+bool ProcPidReader::listTasks(pid_t pid, vector<pid_t> &tids)
+{
+    tids.clear();
+    if (procFd_ < 0)
+        return false;
+
+    // "<pid>/task" (PID는 최대 20자리, 끝의 NUL 포함)
+    char path[32];
+    auto result = to_chars(path, path + 20, static_cast<long long>(pid));
+    memcpy(result.ptr, "/task", 6);
+
+    int taskFd = openat(procFd_, path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (taskFd < 0)
+        return false;
+    DIR *dir = fdopendir(taskFd);
+    if (!dir)
+    {
+        ::close(taskFd);
+        return false;
+    }
+
+    while (dirent *entry = readdir(dir))
+    {
+        pid_t tid = 0;
+        if (parsePidName(entry->d_name, tid))
+        {
+            tids.push_back(tid);
+        }
+    }
+    closedir(dir);
+    return true;
+}
+
+/**
+ * @brief 스레드 하나의 /proc/[pid]/task/[tid]/stat을 읽습니다.
+ *
+ * 스레드 디렉토리는 프로세스 디렉토리와 같은 형식이므로 readPid에 상대 경로를 넘겨 재사용합니다.
+ *
+ * @param pid 프로세스 ID
+ * @param tid 스레드 ID
+ * @param sample 결과를 채울 객체
+ * @return bool 스레드가 존재하고 stat을 읽었으면 true
+ */
+bool ProcPidReader::readTask(pid_t pid, pid_t tid, ProcPidSample &sample)
+{
+    if (procFd_ < 0)
+        return false;
+
+    // "<pid>/task/<tid>" (PID와 TID는 각각 최대 20자리)
+    char path[64];
+    char *p = to_chars(path, path + 20, static_cast<long long>(pid)).ptr;
+    memcpy(p, "/task/", 6);
+    p = to_chars(p + 6, path + sizeof(path) - 1, static_cast<long long>(tid)).ptr;
+    *p = '\0';
+
+    sample.pid = tid;
+    return readPid(procFd_, path, sample, Stat);
+}
+
+/**
+ * @brief 지정한 프로세스 하나의 정보 중 요청한 항목 그룹만 읽습니다.
+ *
+ * @param pid 프로세스 ID
+ * @param sample 결과를 채울 객체 (요청하지 않은 필드는 그대로 유지)
+ * @param fields 이번 호출에서 읽을 항목 그룹 (Field 값의 비트 OR)
+ * @return bool 프로세스가 존재하고 요청한 파일을 모두 읽었으면 true
+ */
+bool ProcPidReader::read(pid_t pid, ProcPidSample &sample, unsigned fields)
+{
+    char name[16];
+    auto result = to_chars(name, name + sizeof(name) - 1, static_cast<long long>(pid));
+    *result.ptr = '\0';
+    sample.pid = pid;
+    if (procFd_ < 0)
+        return false;
+    return readPid(procFd_, name, sample, fields);
+}
+
+/**
+ * @brief 프로세스 디렉토리 하나에서 요청한 항목을 읽습니다.
+ *
+ * 프로세스 디렉토리를 한 번 연 뒤 그 디렉토리 기준으로 파일을 열어
+ * 경로 문자열 생성과 반복적인 경로 탐색을 피합니다.
+ *
+ * @param procFd /proc 디렉토리 파일 디스크립터
+ * @param name 프로세스 디렉토리 이름 (PID 문자열)
+ * @param sample 결과를 채울 객체
+ * @param fields 읽을 항목 그룹
+ * @return bool 요청한 파일을 모두 읽었으면 true
+ */
+bool ProcPidReader::readPid(int procFd, const char *name, ProcPidSample &sample, unsigned fields)
+{
+    int pidFd = openat(procFd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (pidFd < 0)
+        return false;
+
+    bool ok = true;
+    size_t length = 0;
+
+    if (ok && (fields & Owner))
+    {
+        struct stat st{};
+        ok = fstat(pidFd, &st) == 0;
+        sample.uid = st.st_uid;
+    }
+
+    if (ok && (fields & Stat))
+    {
+        ok = readFile(pidFd, "stat", length) && parseStat(length, sample);
+    }
+
+    if (ok && (fields & Statm))
+    {
+        ok = readFile(pidFd, "statm", length) && parseStatm(length, sample);
+    }
+
+    if (ok && (fields & Cmdline))
+    {
+        ok = readFile(pidFd, "cmdline", length);
+        if (ok)
+        {
+            // 인수 구분자 NUL을 공백으로 바꾸고 끝의 구분자는 제거
+            while (length > 0 && buffer_[length - 1] == '\0')
+                length--;
+            sample.cmdline.assign(buffer_.data(), length);
+            replace(sample.cmdline.begin(), sample.cmdline.end(), '\0', ' ');
+        }
+    }
+
+    // io와 fd는 다른 사용자의 프로세스에서 권한이 없을 수 있으므로 실패해도 0으로 두고 계속 진행
+    if (ok && (fields & Io))
+    {
+        sample.ioReadBytes = 0;
+        sample.ioWriteBytes = 0;
+        if (readFile(pidFd, "io", length))
+        {
+            parseIo(length, sample);
+        }
+    }
+
+    if (ok && (fields & Fds))
+    {
+        if (!countFds(pidFd, sample.openFds))
+        {
+            sample.openFds = 0;
+        }
+    }
+
+    if (ok && (fields & Cgroup))
+    {
+        sample.cgroup.clear();
+        if (readFile(pidFd, "cgroup", length))
+        {
+            parseCgroup(length, sample);
+        }
+    }
+
+    ::close(pidFd);
+    return ok;
+}
+
+/**
+ * @brief 파일 전체를 buffer_에 읽습니다.
+ *
+ * 버퍼가 가득 차면 두 배로 키워 이어서 읽으므로 긴 명령행도 잘리지 않습니다.
+ *
+ * @param dirFd 파일이 있는 디렉토리 파일 디스크립터
+ * @param name 파일 이름
+ * @param length 읽은 바이트 수
+ * @return bool 읽었으면 true
+ */
+bool ProcPidReader::readFile(int dirFd, const char *name, size_t &length)
+{
+    int fd = openat(dirFd, name, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+
+    length = 0;
+    while (true)
+    {
+        if (length == buffer_.size())
+        {
+            buffer_.resize(buffer_.size() * 2);
+        }
+
+        ssize_t n = pread(fd, buffer_.data() + length, buffer_.size() - length, static_cast<off_t>(length));
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            ::close(fd);
+            return false;
+        }
+        if (n == 0)
+            break;
+        length += static_cast<size_t>(n);
+    }
+
+    ::close(fd);
+    return true;
+}
+
+/**
+ * @brief /proc/[pid]/stat 내용을 파싱합니다.
+ *
+ * 이름(comm)에는 공백과 괄호가 들어갈 수 있으므로 마지막 ')' 이후부터 필드를 셉니다.
+ * 필드 번호는 proc(5) 기준입니다.
+ *
+ * @param length buffer_에 읽은 바이트 수
+ * @param sample 결과를 채울 객체
+ * @return bool 형식이 올바르면 true
+ */
+bool ProcPidReader::parseStat(size_t length, ProcPidSample &sample) const
+{
+    const char *begin = buffer_.data();
+    const char *end = begin + length;
+    const char *open = static_cast<const char *>(memchr(begin, '(', length));
+    const char *close = static_cast<const char *>(memrchr(begin, ')', length));
+    if (!open || !close || close < open)
+        return false;
+
+    sample.comm.assign(open + 1, close);
+
+    const char *p = close + 1;
+    skipSpaces(p, end);
+    if (p == end)
+        return false;
+    sample.state = *p++; // 3: state
+
+    long long ppid = 0, nice = 0, threads = 0;
+    unsigned long long utime = 0, stime = 0, startTime = 0;
+    if (!parseSigned(p, end, ppid) ||      // 4: ppid
+        !skipFields(p, end, 9) ||          // 5-13: pgrp ~ cmajflt
+        !parseUnsigned(p, end, utime) ||   // 14: utime
+        !parseUnsigned(p, end, stime) ||   // 15: stime
+        !skipFields(p, end, 3) ||          // 16-18: cutime, cstime, priority
+        !parseSigned(p, end, nice) ||      // 19: nice
+        !parseSigned(p, end, threads) ||   // 20: num_threads
+        !skipFields(p, end, 1) ||          // 21: itrealvalue
+        !parseUnsigned(p, end, startTime)) // 22: starttime
+    {
+        return false;
+    }
+
+    sample.ppid = static_cast<pid_t>(ppid);
+    sample.utime = utime;
+    sample.stime = stime;
+    sample.nice = static_cast<long>(nice);
+    sample.numThreads = static_cast<long>(threads);
+    sample.startTime = startTime;
+    return true;
+}
+
+/**
+ * @brief /proc/[pid]/statm 내용을 파싱합니다.
+ *
+ * @param length buffer_에 읽은 바이트 수
+ * @param sample 결과를 채울 객체
+ * @return bool 형식이 올바르면 true
+ */
+bool ProcPidReader::parseStatm(size_t length, ProcPidSample &sample) const
+{
+    const char *p = buffer_.data();
+    const char *end = p + length;
+
+    unsigned long long sizePages = 0, residentPages = 0;
+    if (!parseUnsigned(p, end, sizePages) || !parseUnsigned(p, end, residentPages))
+        return false;
+
+    sample.vmSizeBytes = sizePages * pageSize_;
+    sample.rssBytes = residentPages * pageSize_;
+    return true;
+}
+
+/**
+ * @brief /proc/[pid]/cgroup 내용을 파싱합니다.
+ *
+ * 각 줄은 "계층 ID:컨트롤러 목록:경로" 형식입니다. v1 cpu 컨트롤러 계층이 있으면 그 경로를
+ * (하이브리드 구성에서는 v2 통합 계층이 비어 있는 경우가 많음), 없으면 v2 통합 계층("0::경로")의 경로를,
+ * 둘 다 없으면 첫 줄의 경로를 사용합니다.
+ *
+ * @param length buffer_에 읽은 바이트 수
+ * @param sample 결과를 채울 객체
+ */
+void ProcPidReader::parseCgroup(size_t length, ProcPidSample &sample) const
+{
+    const char *p = buffer_.data();
+    const char *end = p + length;
+    string_view fallback;
+    string_view cpuPath;
+    string_view unifiedPath;
+    bool unified = false;
+
+    while (p < end)
+    {
+        const char *lineEnd = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!lineEnd)
+            lineEnd = end;
+        string_view line(p, static_cast<size_t>(lineEnd - p));
+        p = lineEnd + 1;
+
+        size_t first = line.find(':');
+        size_t second = first == string_view::npos ? string_view::npos : line.find(':', first + 1);
+        if (second == string_view::npos)
+            continue;
+
+        string_view controllers = line.substr(first + 1, second - first - 1);
+        string_view path = line.substr(second + 1);
+        if (line.substr(0, first) == "0" && controllers.empty())
+        {
+            unified = true;
+            unifiedPath = path;
+            continue;
+        }
+
+        // v1: "cpu,cpuacct"처럼 쉼표로 묶인 목록에서 cpu 컨트롤러를 찾음
+        for (size_t start = 0; cpuPath.empty() && start <= controllers.size();)
+        {
+            size_t comma = controllers.find(',', start);
+            size_t stop = comma == string_view::npos ? controllers.size() : comma;
+            if (controllers.substr(start, stop - start) == "cpu")
+                cpuPath = path;
+            start = stop + 1;
+        }
+        if (fallback.empty())
+            fallback = path;
+    }
+
+    string_view chosen = !cpuPath.empty() ? cpuPath : (unified ? unifiedPath : fallback);
+    sample.cgroup.assign(chosen.data(), chosen.size());
+}
+
+/**
+ * @brief /proc/[pid]/io 내용을 파싱합니다.
+ *
+ * "키: 값" 형식의 줄을 버퍼 위에서 바로 비교하므로 문자열을 할당하지 않습니다.
+ * cancelled_write_bytes와 섞이지 않도록 키 전체가 일치하는 줄만 사용합니다.
+ *
+ * @param length buffer_에 읽은 바이트 수
+ * @param sample 결과를 채울 객체
+ */
+void ProcPidReader::parseIo(size_t length, ProcPidSample &sample) const
+{
+    const char *p = buffer_.data();
+    const char *end = p + length;
+
+    while (p < end)
+    {
+        const char *lineEnd = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!lineEnd)
+            lineEnd = end;
+
+        const char *colon = static_cast<const char *>(memchr(p, ':', static_cast<size_t>(lineEnd - p)));
+        if (colon)
+        {
+            string_view key(p, static_cast<size_t>(colon - p));
+            const char *value = colon + 1;
+            unsigned long long parsed = 0;
+            if (key == "read_bytes" && parseUnsigned(value, lineEnd, parsed))
+                sample.ioReadBytes = parsed;
+            else if (key == "write_bytes" && parseUnsigned(value, lineEnd, parsed))
+                sample.ioWriteBytes = parsed;
+        }
+
+        p = lineEnd + 1;
+    }
+}
+
+/**
+ * @brief 프로세스의 열린 파일 디스크립터 수를 셉니다.
+ *
+ * 리눅스 6.2부터 /proc/[pid]/fd 디렉토리의 st_size는 열린 디스크립터 수이므로 stat 한 번으로 끝납니다.
+ * 이전 커널은 st_size가 0이므로 getdents64로 디렉토리 항목을 buffer_에 읽어 세며,
+ * readdir와 달리 항목마다 dirent를 복사하지 않습니다.
+ *
+ * @param pidFd 프로세스 디렉토리 파일 디스크립터
+ * @param count 열린 파일 디스크립터 수
+ * @return bool 셀 수 있었으면 true
+ */
+bool ProcPidReader::countFds(int pidFd, int &count)
+{
+    struct stat st{};
+    if (fstatat(pidFd, "fd", &st, 0) != 0)
+        return false;
+
+    if (st.st_size > 0)
+    {
+        count = static_cast<int>(st.st_size);
+        return true;
+    }
+
+    int fd = openat(pidFd, "fd", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+
+    int entries = 0;
+    while (true)
+    {
+        long n = syscall(SYS_getdents64, fd, buffer_.data(), buffer_.size());
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            ::close(fd);
+            return false;
+        }
+        if (n == 0)
+            break;
+
+        for (long offset = 0; offset < n;)
+        {
+            const auto *entry = reinterpret_cast<const LinuxDirent64 *>(buffer_.data() + offset);
+            if (entry->d_name[0] != '.')
+                entries++;
+            offset += entry->d_reclen;
+        }
+    }
+
+    ::close(fd);
+    count = entries;
+    return true;
+}
@@ -7,26 +7,92 @@
  * 또한 특정 프로세스를 종료하는 기능도 포함하고 있습니다.
  */
 #include "collectors/process_collector.h"
-#include <proc/readproc.h>
+#include "common/proc_file.h"
+#include "common/string_pool.h"
 #include <signal.h>
-#include <cstring>
 #include <stdexcept>
 #include <pwd.h>
 #include <algorithm>
-#include <fstream>
-#include <sstream>
 #include <map>
-#include <dirent.h>
+#include <future>
 
 using namespace std;
 
+namespace
+{
+    /**
+     * @brief CPU 사용량 내림차순 비교 함수
+     */
+    bool byCpuUsage(const ProcessInfo &a, const ProcessInfo &b) { return a.cpu_usage > b.cpu_usage; }
+
+    /**
+     * @brief 메모리 사용량 내림차순 비교 함수
+     */
+    bool byMemoryUsage(const ProcessInfo &a, const ProcessInfo &b) { return a.memory_rss > b.memory_rss; }
+
+    /**
+     * @brief PID 오름차순 비교 함수
+     */
+    bool byPid(const ProcessInfo &a, const ProcessInfo &b) { return a.pid < b.pid; }
+
+    /**
+     * @brief 이름 알파벳순 비교 함수
+     */
+    bool byName(const ProcessInfo &a, const ProcessInfo &b) { return a.name < b.name; }
+
+    /**
+     * @brief 순위 기준 값 내림차순 비교 함수 (힙에서는 기준 값이 가장 작은 후보가 맨 앞)
+     */
+    template <typename Ranked>
+    bool byRankKey(const Ranked &a, const Ranked &b) { return a.first > b.first; }
+
+    /**
+     * @brief 크기가 limit으로 제한된 최소 힙에 후보를 넣음
+     *
+     * 힙이 가득 찼으면 가장 작은 후보보다 클 때만 교체하므로 후보 하나당 O(log K)입니다.
+     */
+    template <typename Ranked>
+    void pushBounded(vector<Ranked> &heap, size_t limit, Ranked candidate)
+    {
+        if (heap.size() < limit)
+        {
+            heap.push_back(candidate);
+            push_heap(heap.begin(), heap.end(), byRankKey<Ranked>);
+        }
+        else if (candidate.first > heap.front().first)
+        {
+            pop_heap(heap.begin(), heap.end(), byRankKey<Ranked>);
+            heap.back() = candidate;
+            push_heap(heap.begin(), heap.end(), byRankKey<Ranked>);
+        }
+    }
+}
+
+/**
+ * @brief 프로세스 수집기 생성자
+ *
+ * @param processOptions 프로세스 수집 옵션
+ */
+ProcessCollector::ProcessCollector(const ProcessOptions &processOptions)
+    : clk_tck(static_cast<unsigned long>(sysconf(_SC_CLK_TCK))), options(processOptions)
+{
+    if (options.processEvents)
+    {
+        connector = make_unique<ProcConnector>(options.eventCapacity);
+        if (!connector->start())
+        {
+            connector.reset();
+        }
+    }
+}
+
 /**
  * @brief 프로세스 상태 코드를 사람이 읽기 쉬운 텍스트로 변환합니다.
  *
  * @param status 프로세스 상태 코드 (예: "R", "S", "I" 등)
- * @return string 사람이 읽기 쉬운 상태 설명
+ * @return string_view 사람이 읽기 쉬운 상태 설명 (알 수 없는 코드는 StringPool에 인터닝해 반환)
  */
-string ProcessCollector::convertStatus(string_view status) const
+string_view ProcessCollector::convertStatus(string_view status) const
 {
     if (status == "R")
         return "Running";
@@ -43,7 +109,7 @@ string ProcessCollector::convertStatus(string_view status) const
     else if (status == "t")
         return "Tracing Stop";
 
-    return string(status);
+    return StringPool::instance().intern(status);
 }
 
 /**
@@ -66,179 +132,609 @@ vector<ProcessInfo> ProcessCollector::getSortedProcesses(Comparator comp) const
  *
  * 이 함수는 시스템에서 실행 중인 모든 프로세스의 상세 정보를 수집하여
  * 내부 processes 벡터에 저장합니다. 수집되는 정보는 PID, CPU/메모리 사용량,
- * 시작 시간, 상태, 명령어 등을 포함합니다.
+ * 시작 시간, 상태, 명령어 등을 포함합니다. 프로세스별 stat, statm, cmdline은
+ * ProcPidReader가 재사용 버퍼에 직접 읽어 파싱합니다.
+ *
+ * PID 목록을 먼저 읽은 뒤 pid % 샤드 수로 나누어 샤드별로 공유 작업자 풀에서 동시에 처리하고,
+ * 샤드별 프로세스 테이블을 마지막에 하나로 합칩니다. 작업자 풀이 없으면 샤드를 차례로 처리합니다.
+ * 테이블은 주기 간 유지되므로 오래 실행 중인 프로세스는 동적 필드만 다시 읽습니다.
  *
  * @throw runtime_error 프로세스 정보에 접근할 수 없는 경우 발생
  */
 void ProcessCollector::collect()
 {
-    processes.clear();
-    processes.reserve(prev_cpu_times.size() > 100 ? prev_cpu_times.size() : 100);
-    unsigned long total_time = 0;
+    // 시스템 부팅 시각은 CPU 수집기와 함께 읽는 /proc/stat의 btime 사용
+    // (uptime으로 역산하면 초 경계에서 1초씩 흔들림)
+    uint64_t btime = 0;
+    const ProcField fields[] = {{"btime ", &btime}};
+    SharedProcFile::stat().read([&fields](string_view text)
+                                { ProcFile::parseFields(text, fields, size(fields)); });
+    time_t boot_time = static_cast<time_t>(btime);
+
+    // CPU 핫플러그를 반영하도록 온라인 CPU 수는 주기마다 다시 읽음
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    online_cpus = cpus > 0 ? static_cast<unsigned>(cpus) : 1;
+
+    // 이벤트를 빠짐없이 받고 있으면 /proc를 다시 나열하지 않고 기존 테이블과 새로 생긴 PID만 읽음
+    // (종료된 PID는 읽기에 실패해 테이블에서 제거됨)
+    bool incremental = false;
+    if (connector)
+    {
+        connector->drainEvents(events);
+        bool complete = connector->drainNewPids(new_pids);
+        incremental = complete && !shards.empty() && cycle % FULL_RESCAN_CYCLES != 0;
+    }
 
-    // 시스템 부팅 시간 계산
-    time_t boot_time = 0;
+    if (!incremental && !ProcPidReader::listPids(all_pids))
     {
-        // /proc/uptime에서 시스템이 부팅된 후 경과 시간(초)을 읽어옴
-        ifstream uptime_file("/proc/uptime");
-        double uptime = 0;
-        if (uptime_file >> uptime)
+        throw runtime_error("Cannot access process information");
+    }
+
+    if (shards.empty())
+    {
+        size_t shard_count = workerPool_ ? min(max<size_t>(workerPool_->size(), 1), MAX_SHARDS) : 1;
+        for (size_t i = 0; i < shard_count; i++)
         {
-            // 현재 시간에서 uptime을 빼서 부팅 시간 계산
-            boot_time = time(nullptr) - static_cast<time_t>(uptime);
+            shards.push_back(make_unique<Shard>());
         }
     }
 
-    // 전체 CPU 시간 계산
-    ifstream stat("/proc/stat");
-    string line;
-    if (getline(stat, line))
+    for (auto &shard : shards)
+    {
+        shard->pids.clear();
+        shard->exec_pids.clear();
+        if (incremental)
+        {
+            for (const auto &entry : shard->table)
+            {
+                shard->pids.push_back(entry.first);
+            }
+        }
+    }
+    if (incremental)
+    {
+        for (pid_t pid : new_pids)
+        {
+            Shard &shard = *shards[static_cast<size_t>(pid) % shards.size()];
+            if (shard.table.count(pid) == 0)
+                shard.pids.push_back(pid);
+        }
+    }
+    else
     {
-        istringstream iss(line);
-        string cpu;
-        unsigned long user, nice, system, idle, iowait, irq, softirq, steal;
-        iss >> cpu >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal;
-        total_time = user + nice + system + idle + iowait + irq + softirq + steal;
+        for (pid_t pid : all_pids)
+        {
+            shards[static_cast<size_t>(pid) % shards.size()]->pids.push_back(pid);
+        }
+    }
+    for (const ProcessEventInfo &event : events)
+    {
+        if (event.type == "exec")
+            shards[static_cast<size_t>(event.pid) % shards.size()]->exec_pids.insert(event.pid);
     }
 
-    PROCTAB *proc = openproc(
-        PROC_FILLMEM |
-        PROC_FILLSTAT |
-        PROC_FILLSTATUS |
-        PROC_FILLUSR |
-        PROC_FILLCOM);
+    uint64_t current_cycle = ++cycle;
 
-    if (proc == nullptr)
+    vector<future<void>> tasks;
+    tasks.reserve(shards.size());
+    for (auto &shard : shards)
     {
-        throw runtime_error("Cannot access process information");
+        Shard *target = shard.get();
+        tasks.push_back(submitSubTask([this, target, boot_time, current_cycle]()
+                                      { collectShard(*target, boot_time, current_cycle); }));
+    }
+    for (auto &task : tasks)
+    {
+        awaitSubTask(task);
     }
 
-    proc_t proc_info;
-    memset(&proc_info, 0, sizeof(proc_info));
+    aggregateGroups();
+    mergeShards();
+    collectTopDetails();
+}
 
-    // 사용자 이름을 캐싱하기 위한 맵
-    static map<uid_t, string> user_cache;
+/**
+ * @brief 두 샘플 사이의 누적 CPU 시간 증가량으로 CPU 사용률을 계산합니다.
+ *
+ * 주기 전체에 대해 한 번 읽은 /proc/stat 합계 대신 프로세스별로 stat을 읽은 단조 시각을 분모로 사용하므로,
+ * /proc 순회 자체가 오래 걸려도 프로세스마다 실제 측정 구간에 맞는 값이 나옵니다.
+ *
+ * @param ticks 이번 샘플의 누적 CPU 시간 (클럭 틱)
+ * @param prev_ticks 직전 샘플의 누적 CPU 시간 (클럭 틱)
+ * @param now 이번 샘플 시각
+ * @param prev 직전 샘플 시각
+ * @param core_usage 코어 하나 대비 사용률 (%)
+ * @return float 전체 머신 대비 사용률 (%)
+ */
+float ProcessCollector::cpuUsage(unsigned long ticks, unsigned long prev_ticks, chrono::steady_clock::time_point now,
+                                 chrono::steady_clock::time_point prev, float &core_usage) const
+{
+    core_usage = 0.0f;
+    double elapsed = chrono::duration<double>(now - prev).count();
+    if (elapsed <= 0.0 || ticks < prev_ticks)
+        return 0.0f;
+
+    double cpu_seconds = static_cast<double>(ticks - prev_ticks) / static_cast<double>(clk_tck);
+    core_usage = static_cast<float>(100.0 * cpu_seconds / elapsed);
+    return core_usage / static_cast<float>(online_cpus);
+}
 
-    while (readproc(proc, &proc_info) != nullptr)
+/**
+ * @brief 프로세스 하나의 스레드별 CPU 사용량을 수집합니다.
+ *
+ * /proc/[pid]/task/[tid]/stat을 읽어 프로세스와 같은 방식으로 TID별 직전 누적 CPU 시간과 비교하며,
+ * 시작 시각이 달라진 TID는 새 스레드로 보고 이번 주기 사용률을 0으로 둡니다.
+ * 결과는 CPU 사용률 내림차순으로 정렬합니다.
+ *
+ * @param shard 프로세스가 배정된 샤드
+ * @param entry 프로세스 테이블 항목
+ * @param current_cycle 이번 수집 주기 번호
+ */
+void ProcessCollector::collectThreads(Shard &shard, ProcessEntry &entry, uint64_t current_cycle)
+{
+    ProcessInfo &info = entry.info;
+    info.thread_details.clear();
+    if (!shard.reader.listTasks(info.pid, shard.tids))
     {
-        ProcessInfo process;
-        process.pid = proc_info.tid;
-        process.ppid = proc_info.ppid;
-        process.name = proc_info.cmd;
-
-        // 사용자 이름 캐싱 활용
-        auto uid = static_cast<uid_t>(proc_info.euid);
-        auto user_it = user_cache.find(uid);
-        if (user_it != user_cache.end())
+        entry.threads.clear();
+        return;
+    }
+
+    ProcPidSample &task = shard.task_sample;
+    for (pid_t tid : shard.tids)
+    {
+        if (!shard.reader.readTask(info.pid, tid, task))
         {
-            process.user = user_it->second;
+            continue;
         }
-        else
+        auto sample_time = chrono::steady_clock::now();
+
+        auto [it, inserted] = entry.threads.try_emplace(tid);
+        ThreadEntry &thread = it->second;
+        bool is_new = inserted || thread.start_ticks != task.startTime;
+
+        unsigned long thread_total_time = static_cast<unsigned long>(task.utime + task.stime);
+        float cpu_usage = 0.0f;
+        float cpu_core_usage = 0.0f;
+        if (!is_new)
         {
-            struct passwd *pw = getpwuid(uid);
-            process.user = pw ? pw->pw_name : to_string(uid);
-            user_cache[uid] = process.user;
+            cpu_usage = cpuUsage(thread_total_time, thread.prev_cpu_ticks, sample_time, thread.prev_sample_time,
+                                 cpu_core_usage);
         }
 
-        process.memory_rss = proc_info.vm_rss * 1024;  // memory_usage 대신 memory_rss 사용
-        process.memory_vsz = proc_info.vm_size * 1024; // 가상 메모리 크기 추가
-        process.threads = proc_info.nlwp;              // 스레드 수
+        thread.start_ticks = task.startTime;
+        thread.prev_cpu_ticks = thread_total_time;
+        thread.prev_sample_time = sample_time;
+        thread.seen_cycle = current_cycle;
+
+        info.thread_details.push_back({tid, task.comm,
+                                       convertStatus(string_view(&task.state, 1)), cpu_usage, cpu_core_usage,
+                                       static_cast<float>(thread_total_time) / static_cast<float>(clk_tck)});
+    }
+
+    // 종료된 스레드 제거
+    for (auto it = entry.threads.begin(); it != entry.threads.end();)
+    {
+        if (it->second.seen_cycle != current_cycle)
+            it = entry.threads.erase(it);
+        else
+            ++it;
+    }
 
-        // 프로세스 시작 시간 설정 (boot_time 사용)
-        unsigned long clk_tck = static_cast<unsigned long>(sysconf(_SC_CLK_TCK));
-        process.start_time = boot_time + static_cast<time_t>(proc_info.start_time / clk_tck);
+    sort(info.thread_details.begin(), info.thread_details.end(),
+         [](const ThreadInfo &a, const ThreadInfo &b)
+         { return a.cpu_usage > b.cpu_usage; });
+}
 
-        // CPU 사용량 계산 로직 최적화
-        unsigned long process_total_time = proc_info.utime + proc_info.stime;
-        auto it = prev_cpu_times.find(process.pid);
+/**
+ * @brief 모든 프로세스를 프로세스 트리와 cgroup 단위로 합산합니다.
+ *
+ * PID 1의 자식, 부모가 없는 프로세스(PID 1, kthreadd 등), 부모가 목록에 없는 프로세스를 트리 루트로 보고,
+ * 부모 → 자식 인덱스를 CSR 형식으로 한 번 만든 뒤 루트마다 하위 트리를 순회해 각 프로세스를 정확히 한 번씩 합산합니다.
+ * cgroup은 프로세스가 처음 관측될 때 읽은 경로별로 합산합니다.
+ */
+void ProcessCollector::aggregateGroups()
+{
+    process_trees.clear();
+    cgroups.clear();
+    if (!options.groupTrees && !options.groupCgroups)
+    {
+        return;
+    }
 
-        if (it != prev_cpu_times.end() && total_time > prev_total_time)
+    group_entries.clear();
+    for (const auto &shard : shards)
+    {
+        for (const auto &entry : shard->table)
         {
-            unsigned long time_diff = process_total_time - it->second.first;
-            unsigned long total_time_diff = total_time - prev_total_time;
+            group_entries.push_back(&entry.second);
+        }
+    }
 
-            process.cpu_usage = 100.0f * (static_cast<float>(time_diff) / static_cast<float>(total_time_diff));
+    auto accumulate = [](ProcessGroupInfo &group, const ProcessInfo &info)
+    {
+        group.process_count++;
+        group.threads += info.threads;
+        group.cpu_usage += info.cpu_usage;
+        group.memory_rss += info.memory_rss;
+        group.io_read_bytes += info.io_read_bytes;
+        group.io_write_bytes += info.io_write_bytes;
+    };
+    auto byGroupCpu = [](const ProcessGroupInfo &a, const ProcessGroupInfo &b)
+    { return a.cpu_usage > b.cpu_usage; };
+
+    if (options.groupTrees)
+    {
+        size_t count = group_entries.size();
+        group_index.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            group_index[group_entries[i]->info.pid] = i;
         }
-        else
+
+        // 부모 인덱스 (루트는 count)
+        auto parentOf = [this, count](size_t i)
+        {
+            pid_t ppid = group_entries[i]->info.ppid;
+            if (ppid <= 1)
+                return count;
+            auto it = group_index.find(ppid);
+            return it == group_index.end() ? count : it->second;
+        };
+
+        child_offsets.assign(count + 1, 0);
+        for (size_t i = 0; i < count; i++)
         {
-            process.cpu_usage = 0.0f;
+            size_t parent = parentOf(i);
+            if (parent != count)
+                child_offsets[parent + 1]++;
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            child_offsets[i + 1] += child_offsets[i];
+        }
+        children.resize(child_offsets[count]);
+        group_stack.assign(child_offsets.begin(), child_offsets.end() - 1); // 자식별 채울 위치로 임시 사용
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t parent = parentOf(i);
+            if (parent != count)
+                children[group_stack[parent]++] = i;
         }
 
-        // CPU 시간 (초 단위)
-        process.cpu_time = static_cast<float>((proc_info.utime + proc_info.stime)) / static_cast<float>(sysconf(_SC_CLK_TCK));
+        for (size_t root = 0; root < count; root++)
+        {
+            if (parentOf(root) != count)
+                continue;
+
+            const ProcessInfo &root_info = group_entries[root]->info;
+            process_trees.emplace_back();
+            ProcessGroupInfo &group = process_trees.back();
+            group.id = to_string(root_info.pid);
+            group.name = root_info.name;
+
+            group_stack.clear();
+            group_stack.push_back(root);
+            while (!group_stack.empty())
+            {
+                size_t node = group_stack.back();
+                group_stack.pop_back();
+                accumulate(group, group_entries[node]->info);
+                group_stack.insert(group_stack.end(), children.begin() + static_cast<ptrdiff_t>(child_offsets[node]),
+                                   children.begin() + static_cast<ptrdiff_t>(child_offsets[node + 1]));
+            }
+        }
+        sort(process_trees.begin(), process_trees.end(), byGroupCpu);
+    }
 
-        prev_cpu_times[process.pid] = make_pair(process_total_time, total_time);
+    if (options.groupCgroups)
+    {
+        cgroup_index.clear();
+        for (const ProcessEntry *entry : group_entries)
+        {
+            auto [it, inserted] = cgroup_index.try_emplace(entry->cgroup, cgroups.size());
+            if (inserted)
+            {
+                cgroups.emplace_back();
+                ProcessGroupInfo &group = cgroups.back();
+                group.id = entry->cgroup;
+                size_t slash = entry->cgroup.find_last_of('/');
+                group.name = (slash == string::npos || slash + 1 == entry->cgroup.size())
+                                 ? entry->cgroup
+                                 : entry->cgroup.substr(slash + 1);
+            }
+            accumulate(cgroups[it->second], entry->info);
+        }
+        sort(cgroups.begin(), cgroups.end(), byGroupCpu);
+    }
+}
 
-        process.status = convertStatus(&proc_info.state);
-        process.command.reserve(128); // 적절한 초기 크기로 예약
-        if (proc_info.cmdline)
+/**
+ * @brief 샤드별 프로세스 테이블을 processes로 합칩니다.
+ *
+ * 기존 요소에 복사 대입해 문자열 버퍼를 재사용합니다. topK가 0보다 크면 샤드마다 순회 중에 모은
+ * 상위 K개 후보 중에서 다시 K개를 고르고 허용 목록 항목을 더해, 복사량이 K에 비례하도록 합니다.
+ */
+void ProcessCollector::mergeShards()
+{
+    size_t index = 0;
+    if (options.topK == 0)
+    {
+        size_t total = 0;
+        for (const auto &shard : shards)
         {
-            for (int i = 0; proc_info.cmdline[i]; i++)
+            total += shard->table.size();
+        }
+        processes.resize(total);
+
+        for (const auto &shard : shards)
+        {
+            for (const auto &entry : shard->table)
             {
-                if (i > 0)
-                    process.command += ' ';
-                process.command += proc_info.cmdline[i];
+                processes[index++] = entry.second.info;
             }
         }
-        if (process.command.empty())
+        return;
+    }
+
+    top_candidates.clear();
+    size_t pinned = 0;
+    for (const auto &shard : shards)
+    {
+        top_candidates.insert(top_candidates.end(), shard->top.begin(), shard->top.end());
+        pinned += shard->pinned.size();
+    }
+    if (top_candidates.size() > options.topK)
+    {
+        auto kth = top_candidates.begin() + static_cast<ptrdiff_t>(options.topK);
+        nth_element(top_candidates.begin(), kth, top_candidates.end(), byRankKey<RankedEntry>);
+        top_candidates.resize(options.topK);
+    }
+
+    processes.resize(top_candidates.size() + pinned);
+    for (const auto &candidate : top_candidates)
+    {
+        processes[index++] = candidate.second->info;
+    }
+    for (const auto &shard : shards)
+    {
+        for (const ProcessEntry *entry : shard->pinned)
         {
-            process.command = process.name;
+            processes[index++] = entry->info;
         }
+    }
+}
 
-        // 추가 필드 설정
-        process.nice = proc_info.nice;
+/**
+ * @brief CPU 사용률 상위 프로세스에만 I/O 통계와 열린 파일 수를 채웁니다.
+ *
+ * /proc/[pid]/io와 fd 디렉토리는 프로세스마다 추가 시스템 호출이 필요하므로,
+ * ioLimit 또는 fdLimit이 양수이면 병합된 목록에서 CPU 사용률 상위 N개만 골라 읽습니다.
+ * 결과는 병합된 processes에만 기록되며 프로세스 테이블에는 남지 않습니다.
+ */
+void ProcessCollector::collectTopDetails()
+{
+    size_t io_count = options.ioLimit > 0 && !readsAllIo() ? static_cast<size_t>(options.ioLimit) : 0;
+    size_t fd_count = options.fdLimit > 0 ? static_cast<size_t>(options.fdLimit) : 0;
+    size_t count = min(max(io_count, fd_count), processes.size());
+    if (count == 0 || shards.empty())
+    {
+        return;
+    }
 
-        // I/O 통계 및 열린 파일 수 처리 (파일에서 읽어와야 함)
-        try
+    detail_order.resize(processes.size());
+    for (size_t i = 0; i < detail_order.size(); i++)
+    {
+        detail_order[i] = i;
+    }
+    partial_sort(detail_order.begin(), detail_order.begin() + static_cast<ptrdiff_t>(count), detail_order.end(),
+                 [this](size_t a, size_t b)
+                 { return processes[a].cpu_usage > processes[b].cpu_usage; });
+
+    // 샤드 작업이 모두 끝난 뒤이므로 첫 번째 샤드의 리더와 버퍼를 빌려 씀
+    ProcPidReader &reader = shards[0]->reader;
+    ProcPidSample &sample = shards[0]->sample;
+    for (size_t rank = 0; rank < count; rank++)
+    {
+        ProcessInfo &info = processes[detail_order[rank]];
+        unsigned fields = (rank < io_count ? ProcPidReader::Io : 0u) | (rank < fd_count ? ProcPidReader::Fds : 0u);
+        if (!reader.read(info.pid, sample, fields))
+        {
+            continue;
+        }
+        if (fields & ProcPidReader::Io)
+        {
+            info.io_read_bytes = sample.ioReadBytes;
+            info.io_write_bytes = sample.ioWriteBytes;
+        }
+        if (fields & ProcPidReader::Fds)
         {
-            process.io_read_bytes = 0;
-            process.io_write_bytes = 0;
-            process.open_files = 0;
+            info.open_files = sample.openFds;
+        }
+    }
+}
 
-            // /proc/{pid}/io에서 I/O 통계 읽기
-            ifstream io_file("/proc/" + to_string(process.pid) + "/io");
-            if (io_file)
+/**
+ * @brief 샤드 작업에서 모든 프로세스의 /proc/[pid]/io를 읽어야 하는지 확인합니다.
+ *
+ * 합산 정보는 모든 프로세스를 더하므로 ioLimit이 N이어도 전체를 읽어야 I/O 합계가 맞습니다.
+ * 이 경우 collectTopDetails는 I/O를 다시 읽지 않습니다.
+ *
+ * @return bool 모든 프로세스의 I/O를 읽어야 하면 true
+ */
+bool ProcessCollector::readsAllIo() const
+{
+    if (options.ioLimit < 0)
+        return true;
+    if (options.topK > 0 && options.rankBy == ProcessRank::Io)
+        return true;
+    return options.ioLimit > 0 && (options.groupTrees || options.groupCgroups);
+}
+
+/**
+ * @brief 샤드 하나에 배정된 프로세스들의 정보를 수집합니다.
+ *
+ * 작업자 스레드에서 실행되며 샤드 자신의 상태와 읽기 전용인 clk_tck, online_cpus, options만 접근합니다.
+ * 모든 PID에 대해 stat, statm(전체 수집 모드이면 io와 fd 포함)을 읽고, 테이블에 없거나 시작 시각이 달라진(재사용된) PID에 대해서만
+ * cmdline과 소유자를 추가로 읽어 이름, 사용자, 명령행, 시작 시각을 채웁니다.
+ * topK가 0보다 크면 순회하면서 크기 K의 최소 힙에 상위 후보를 모으고, 허용 목록 항목은 따로 모읍니다.
+ * 목록을 읽은 뒤 종료된 프로세스는 건너뛰고, 이번 주기에 관측되지 않은 항목은 테이블에서 제거합니다.
+ *
+ * @param shard 처리할 샤드
+ * @param boot_time 시스템 부팅 시각
+ * @param current_cycle 이번 수집 주기 번호
+ */
+void ProcessCollector::collectShard(Shard &shard, time_t boot_time, uint64_t current_cycle)
+{
+    ProcPidSample &sample = shard.sample;
+
+    bool ranked = options.topK > 0;
+    unsigned detail_fields = (readsAllIo() ? ProcPidReader::Io : 0u) |
+                             (options.fdLimit < 0 ? ProcPidReader::Fds : 0u);
+
+    shard.top.clear();
+    shard.pinned.clear();
+
+    for (pid_t pid : shard.pids)
+    {
+        if (!shard.reader.read(pid, sample, ProcPidReader::Stat | ProcPidReader::Statm | detail_fields))
+        {
+            continue;
+        }
+        auto sample_time = chrono::steady_clock::now();
+
+        auto [it, inserted] = shard.table.try_emplace(pid);
+        ProcessEntry &entry = it->second;
+        bool is_new = inserted || entry.start_ticks != sample.startTime;
+        ProcessInfo &info = entry.info;
+
+        // execve는 PID와 시작 시각을 유지하므로 comm이 바뀌었거나 exec 이벤트를 받았으면 정적 필드를 다시 읽음
+        bool is_exec = !is_new && (info.name != sample.comm || shard.exec_pids.count(pid) != 0);
+
+        if (is_new || is_exec)
+        {
+            // 새 프로세스, 재사용된 PID 또는 다른 프로그램을 실행한 프로세스: 정적 필드를 다시 채움
+            unsigned static_fields = ProcPidReader::Cmdline | ProcPidReader::Owner |
+                                     (is_new && options.groupCgroups ? ProcPidReader::Cgroup : 0u);
+            if (!shard.reader.read(pid, sample, static_fields))
             {
-                string io_line;
-                while (getline(io_file, io_line))
-                {
-                    if (io_line.find("read_bytes") != string::npos)
-                    {
-                        process.io_read_bytes = stoull(io_line.substr(io_line.find(":") + 1));
-                    }
-                    else if (io_line.find("write_bytes") != string::npos)
-                    {
-                        process.io_write_bytes = stoull(io_line.substr(io_line.find(":") + 1));
-                    }
-                }
+                shard.table.erase(it);
+                continue;
             }
 
-            // 열린 파일 수 계산 개선
-            string fd_path = "/proc/" + to_string(process.pid) + "/fd";
-            DIR *dir = opendir(fd_path.c_str());
-            if (dir)
+            entry.start_ticks = sample.startTime;
+            if (is_new && options.groupCgroups)
+                entry.cgroup = sample.cgroup;
+            info.pid = pid;
+            info.name = sample.comm;
+            if (sample.cmdline.empty())
+                info.command = info.name;
+            else
+                info.command = sample.cmdline;
+
+            // 프로세스 시작 시간 설정 (boot_time 사용)
+            info.start_time = boot_time + static_cast<time_t>(sample.startTime / clk_tck);
+
+            // 사용자 이름 캐싱 활용
+            auto uid = sample.uid;
+            auto user_it = shard.user_cache.find(uid);
+            if (user_it != shard.user_cache.end())
+            {
+                info.user = user_it->second;
+            }
+            else
             {
-                process.open_files = -2; // "." 및 ".." 제외
-                while (readdir(dir) != nullptr)
-                {
-                    process.open_files++;
-                }
-                closedir(dir);
-                if (process.open_files < 0)
-                    process.open_files = 0;
+                // 여러 샤드가 동시에 조회하므로 재진입 가능한 getpwuid_r 사용
+                struct passwd pw{};
+                struct passwd *found = nullptr;
+                char pw_buffer[1024];
+                getpwuid_r(uid, &pw, pw_buffer, sizeof(pw_buffer), &found);
+                info.user = StringPool::instance().intern(found ? string(found->pw_name) : to_string(uid));
+                shard.user_cache[uid] = info.user;
             }
         }
-        catch (const std::exception &e)
+
+        info.ppid = sample.ppid;
+        info.memory_rss = sample.rssBytes;
+        info.memory_vsz = sample.vmSizeBytes;
+        info.threads = static_cast<int>(sample.numThreads);
+        info.nice = sample.nice;
+        info.status = convertStatus(string_view(&sample.state, 1));
+
+        // CPU 사용량은 같은 프로세스의 직전 샘플이 있을 때만 계산 (샘플 간 단조 시각 기준)
+        unsigned long process_total_time = static_cast<unsigned long>(sample.utime + sample.stime);
+        if (!is_new)
+        {
+            info.cpu_usage = cpuUsage(process_total_time, entry.prev_cpu_ticks, sample_time, entry.prev_sample_time,
+                                      info.cpu_core_usage);
+        }
+        else
+        {
+            info.cpu_usage = 0.0f;
+            info.cpu_core_usage = 0.0f;
+        }
+
+        // CPU 시간 (초 단위)
+        info.cpu_time = static_cast<float>(process_total_time) / static_cast<float>(clk_tck);
+
+        entry.prev_cpu_ticks = process_total_time;
+        entry.prev_sample_time = sample_time;
+        entry.seen_cycle = current_cycle;
+
+        // I/O 통계와 열린 파일 수는 전체 수집 모드일 때만 여기서 채움 (상위 N개 모드는 collectTopDetails에서 처리)
+        info.io_read_bytes = (detail_fields & ProcPidReader::Io) ? sample.ioReadBytes : 0;
+        info.io_write_bytes = (detail_fields & ProcPidReader::Io) ? sample.ioWriteBytes : 0;
+        info.open_files = (detail_fields & ProcPidReader::Fds) ? sample.openFds : 0;
+
+        if (!options.threadPids.empty() || !options.threadNames.empty())
         {
-            // 구체적인 예외 처리 및 로깅 (필요시)
-            // std::cerr << "Error reading process info for PID " << process.pid << ": " << e.what() << std::endl;
+            if (options.threadPids.count(pid) || options.threadNames.count(info.name))
+            {
+                collectThreads(shard, entry, current_cycle);
+            }
+            else
+            {
+                info.thread_details.clear();
+                entry.threads.clear();
+            }
         }
 
-        processes.push_back(process);
+        if (ranked)
+        {
+            if (options.rankBy == ProcessRank::Cpu)
+            {
+                entry.rank_key = info.cpu_usage;
+            }
+            else if (options.rankBy == ProcessRank::Memory)
+            {
+                entry.rank_key = static_cast<double>(info.memory_rss);
+            }
+            else
+            {
+                // 누적값이 아닌 직전 주기 이후 증가량으로 순위를 매김
+                uint64_t io_bytes = info.io_read_bytes + info.io_write_bytes;
+                entry.rank_key = (!is_new && io_bytes >= entry.prev_io_bytes)
+                                     ? static_cast<double>(io_bytes - entry.prev_io_bytes)
+                                     : 0.0;
+                entry.prev_io_bytes = io_bytes;
+            }
+
+            // 테이블 항목의 주소는 재해시와 다른 항목 제거에도 유지되므로 주기 끝까지 유효함
+            if (options.includePids.count(pid) || options.includeNames.count(info.name))
+                shard.pinned.push_back(&entry);
+            else
+                pushBounded(shard.top, options.topK, RankedEntry(entry.rank_key, &entry));
+        }
     }
 
-    prev_total_time = total_time;
-    closeproc(proc);
+    // 종료된 프로세스 제거
+    for (auto it = shard.table.begin(); it != shard.table.end();)
+    {
+        if (it->second.seen_cycle != current_cycle)
+            it = shard.table.erase(it);
+        else
+            ++it;
+    }
 }
 
 /**
@@ -248,8 +744,7 @@ void ProcessCollector::collect()
  */
 vector<ProcessInfo> ProcessCollector::getProcessesByCpuUsage() const
 {
-    return getSortedProcesses([](const ProcessInfo &a, const ProcessInfo &b)
-                              { return a.cpu_usage > b.cpu_usage; });
+    return getSortedProcesses(byCpuUsage);
 }
 
 /**
@@ -259,8 +754,7 @@ vector<ProcessInfo> ProcessCollector::getProcessesByCpuUsage() const
  */
 vector<ProcessInfo> ProcessCollector::getProcessesByMemoryUsage() const
 {
-    return getSortedProcesses([](const ProcessInfo &a, const ProcessInfo &b)
-                              { return a.memory_rss > b.memory_rss; });
+    return getSortedProcesses(byMemoryUsage);
 }
 
 /**
@@ -270,8 +764,7 @@ vector<ProcessInfo> ProcessCollector::getProcessesByMemoryUsage() const
  */
 vector<ProcessInfo> ProcessCollector::getProcessesByPid() const
 {
-    return getSortedProcesses([](const ProcessInfo &a, const ProcessInfo &b)
-                              { return a.pid < b.pid; });
+    return getSortedProcesses(byPid);
 }
 
 /**
@@ -281,8 +774,7 @@ vector<ProcessInfo> ProcessCollector::getProcessesByPid() const
  */
 vector<ProcessInfo> ProcessCollector::getProcessesByName() const
 {
-    return getSortedProcesses([](const ProcessInfo &a, const ProcessInfo &b)
-                              { return a.name < b.name; });
+    return getSortedProcesses(byName);
 }
 
 /**
@@ -304,6 +796,28 @@ vector<ProcessInfo> ProcessCollector::getProcesses(int sort_by) const
     return processes;
 }
 
+/**
+ * @brief 지정된 정렬 기준에 따라 정렬된 프로세스 목록을 기존 벡터에 채웁니다.
+ *
+ * 복사 대입 후 제자리에서 정렬하므로 out이 이전 주기에 할당한
+ * 벡터와 문자열 버퍼가 재사용됩니다.
+ *
+ * @param sort_by 정렬 기준 (0: CPU 사용량, 1: 메모리 사용량, 2: PID, 3: 이름)
+ * @param out 결과를 채울 벡터
+ */
+void ProcessCollector::getProcesses(int sort_by, vector<ProcessInfo> &out) const
+{
+    out = processes;
+    if (sort_by == 0)
+        sort(out.begin(), out.end(), byCpuUsage);
+    else if (sort_by == 1)
+        sort(out.begin(), out.end(), byMemoryUsage);
+    else if (sort_by == 2)
+        sort(out.begin(), out.end(), byPid);
+    else if (sort_by == 3)
+        sort(out.begin(), out.end(), byName);
+}
+
 /**
  * @brief 지정된 PID의 프로세스에 종료 신호(SIGTERM)를 보냅니다.
  *
@@ -318,108 +832,52 @@ bool ProcessCollector::killProcess(pid_t pid)
 /**
  * @brief 메모리 사용량이 높은 상위 N개 프로세스 목록을 반환합니다.
  *
- * 전체 목록을 정렬하는 대신 부분 정렬을 사용하여 성능을 향상시킵니다.
- *
  * @param count 반환할 프로세스 수
  * @return vector<ProcessInfo> 메모리 사용량 기준 상위 N개 프로세스
  */
 vector<ProcessInfo> ProcessCollector::getTopProcessesByMemory(size_t count) const
 {
-    vector<ProcessInfo> result = processes;
-
-    // 전체 정렬 대신 부분 정렬 사용 (성능 향상)
-    partial_sort(result.begin(),
-                 result.begin() + static_cast<ptrdiff_t>(min(count, result.size())),
-                 result.end(),
-                 [](const ProcessInfo &a, const ProcessInfo &b)
-                 {
-                     return a.memory_rss > b.memory_rss;
-                 });
-
-    // 필요한 크기로 결과 자르기
-    if (result.size() > count)
-    {
-        result.resize(count);
-    }
-
+    vector<ProcessInfo> result(min(count, processes.size()));
+    partial_sort_copy(processes.begin(), processes.end(), result.begin(), result.end(), byMemoryUsage);
     return result;
 }
 
 /**
  * @brief CPU 사용량이 높은 상위 N개 프로세스 목록을 반환합니다.
  *
- * 전체 목록을 정렬하는 대신 부분 정렬을 사용하여 성능을 향상시킵니다.
- *
  * @param count 반환할 프로세스 수
  * @return vector<ProcessInfo> CPU 사용량 기준 상위 N개 프로세스
  */
 vector<ProcessInfo> ProcessCollector::getTopProcessesByCpu(size_t count) const
 {
-    vector<ProcessInfo> result = processes;
-
-    partial_sort(result.begin(),
-                 result.begin() + static_cast<ptrdiff_t>(min(count, result.size())),
-                 result.end(),
-                 [](const ProcessInfo &a, const ProcessInfo &b)
-                 {
-                     return a.cpu_usage > b.cpu_usage;
-                 });
-
-    if (result.size() > count)
-    {
-        result.resize(count);
-    }
-
+    vector<ProcessInfo> result(min(count, processes.size()));
+    partial_sort_copy(processes.begin(), processes.end(), result.begin(), result.end(), byCpuUsage);
     return result;
 }
 
 /**
  * @brief PID가 낮은 순으로 상위 N개 프로세스 목록을 반환합니다.
  *
- * 전체 목록을 정렬하는 대신 부분 정렬을 사용하여 성능을 향상시킵니다.
- *
  * @param count 반환할 프로세스 수
  * @return vector<ProcessInfo> PID 기준 상위 N개 프로세스
  */
 vector<ProcessInfo> ProcessCollector::getTopProcessesByPid(size_t count) const
 {
-    vector<ProcessInfo> result = processes;
-    partial_sort(result.begin(),
-                 result.begin() + static_cast<ptrdiff_t>(min(count, result.size())),
-                 result.end(),
-                 [](const ProcessInfo &a, const ProcessInfo &b)
-                 {
-                     return a.pid < b.pid;
-                 });
-
-    if (result.size() > count)
-        result.resize(count);
-
+    vector<ProcessInfo> result(min(count, processes.size()));
+    partial_sort_copy(processes.begin(), processes.end(), result.begin(), result.end(), byPid);
     return result;
 }
 
 /**
  * @brief 이름 알파벳 순으로 상위 N개 프로세스 목록을 반환합니다.
  *
- * 전체 목록을 정렬하는 대신 부분 정렬을 사용하여 성능을 향상시킵니다.
- *
  * @param count 반환할 프로세스 수
  * @return vector<ProcessInfo> 이름 기준 상위 N개 프로세스
  */
 vector<ProcessInfo> ProcessCollector::getTopProcessesByName(size_t count) const
 {
-    vector<ProcessInfo> result = processes;
-    partial_sort(result.begin(),
-                 result.begin() + static_cast<ptrdiff_t>(min(count, result.size())),
-                 result.end(),
-                 [](const ProcessInfo &a, const ProcessInfo &b)
-                 {
-                     return a.name < b.name;
-                 });
-
-    if (result.size() > count)
-        result.resize(count);
-
+    vector<ProcessInfo> result(min(count, processes.size()));
+    partial_sort_copy(processes.begin(), processes.end(), result.begin(), result.end(), byName);
     return result;
 }
 
@@ -1,4 +1,5 @@
 #include "commands/command_types.h"
+#include "collectors/hardware_inventory.h"
 #include "log/logger.h"
 
 using namespace std;
@@ -7,12 +8,13 @@ using namespace std;
  * @brief A 타입 명령어를 실행하는 함수
  *
  * 이 함수는 A 타입 명령어를 처리합니다.
+ * commandStatus가 1이면 하드웨어 인벤토리(DMI 테이블)를 다시 읽습니다.
  * 명령어 실행 과정에서 로그를 남기고 적절한 결과 상태를 설정합니다.
  *
  * @param command 실행할 명령어 정보가 담긴 CommandResult 객체
  * @return CommandResult 명령어 실행 결과를 담은 객체
  * @see CommandResult
- * @note 현재 구현에서는 항상 성공(1) 상태를 반환합니다
+ * @note 하드웨어 인벤토리 갱신 외의 요청은 항상 성공(1) 상태를 반환합니다
  */
 CommandResult CommandTypeAExecutor::execute(const CommandResult &command)
 {
@@ -20,6 +22,15 @@ CommandResult CommandTypeAExecutor::execute(const CommandResult &command)
 
     LOG_INFO("A 타입 커맨드 실행 중: ID={}", command.commandID);
 
+    if (command.commandStatus == 1) // 하드웨어 인벤토리 갱신
+    {
+        LOG_INFO("하드웨어 인벤토리 갱신 중: ID={}", command.commandID);
+        bool ok = HardwareInventory::instance().refresh();
+        result.resultStatus = ok ? 1 : 0;
+        result.resultMessage = ok ? "하드웨어 인벤토리 갱신 완료" : "DMI 테이블을 읽을 수 없습니다";
+        return result;
+    }
+
     // A 타입 커맨드 실제 구현 로직
     // 예: 시스템 상태 정보 수집
 
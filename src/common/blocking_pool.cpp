@@ -0,0 +1,146 @@
+/**
+ * @file blocking_pool.cpp
+ * @brief 끝나지 않을 수 있는 호출을 위한 가변 크기 스레드 풀 구현
+ */
+
+#include "common/blocking_pool.h"
+#include "log/logger.h"
+#include <algorithm>
+#include <system_error>
+#include <thread>
+
+using namespace std;
+
+/**
+ * @brief 풀 생성자
+ *
+ * @param maxThreads 동시에 존재할 수 있는 최대 스레드 수 (최소 1)
+ * @param idleTimeout 유휴 스레드가 종료되기까지의 시간
+ */
+BlockingPool::BlockingPool(size_t maxThreads, chrono::milliseconds idleTimeout)
+    : state_(make_shared<State>())
+{
+    state_->maxThreads = max<size_t>(1, maxThreads);
+    state_->idleTimeout = idleTimeout;
+}
+
+/**
+ * @brief 풀 소멸자
+ *
+ * 대기 중인 작업을 폐기하고 유휴 스레드를 깨웁니다. 폐기할 작업은 잠금 밖에서 소멸시켜
+ * packaged_task 소멸 중 future 쪽 콜백이 잠금을 다시 잡지 않도록 합니다.
+ */
+BlockingPool::~BlockingPool()
+{
+    deque<function<void()>> dropped;
+    {
+        lock_guard<mutex> lock(state_->stateMutex);
+        state_->stop = true;
+        dropped.swap(state_->tasks);
+    }
+    state_->wakeUp.notify_all();
+}
+
+/**
+ * @brief 프로세스 전체에서 공유하는 풀 반환
+ *
+ * @return BlockingPool& 공유 풀
+ */
+BlockingPool &BlockingPool::shared()
+{
+    static BlockingPool pool;
+    return pool;
+}
+
+/**
+ * @brief 현재 존재하는 스레드 수 반환 (멈춘 스레드 포함)
+ *
+ * @return size_t 스레드 수
+ */
+size_t BlockingPool::threadCount() const
+{
+    lock_guard<mutex> lock(state_->stateMutex);
+    return state_->threads;
+}
+
+/**
+ * @brief 작업을 큐에 추가하고 필요하면 스레드를 새로 만듭니다.
+ *
+ * 대기 중인 작업 수보다 유휴 스레드가 적고 최대 스레드 수에 이르지 않았으면 스레드를 하나 만듭니다.
+ * 스레드를 만들지 못하면 기존 스레드가 작업을 처리할 때까지 큐에 남겨 둡니다.
+ *
+ * @param task 추가할 작업
+ */
+void BlockingPool::push(function<void()> task)
+{
+    bool spawn = false;
+    {
+        lock_guard<mutex> lock(state_->stateMutex);
+        state_->tasks.push_back(move(task));
+        if (state_->idle < state_->tasks.size() && state_->threads < state_->maxThreads)
+        {
+            state_->threads++;
+            spawn = true;
+        }
+    }
+
+    if (!spawn)
+    {
+        state_->wakeUp.notify_one();
+        return;
+    }
+
+    try
+    {
+        thread(&BlockingPool::threadLoop, state_).detach();
+    }
+    catch (const system_error &e)
+    {
+        {
+            lock_guard<mutex> lock(state_->stateMutex);
+            state_->threads--;
+        }
+        LOG_WARN("블로킹 작업 스레드 생성 실패: {}", e.what());
+        state_->wakeUp.notify_one();
+    }
+}
+
+/**
+ * @brief 스레드 메인 루프
+ *
+ * 작업이 없는 채로 유휴 시간이 지나거나 풀이 소멸되면 종료합니다.
+ *
+ * @param state 공유 상태
+ */
+void BlockingPool::threadLoop(shared_ptr<State> state)
+{
+    unique_lock<mutex> lock(state->stateMutex);
+    while (true)
+    {
+        if (!state->tasks.empty())
+        {
+            function<void()> task = move(state->tasks.front());
+            state->tasks.pop_front();
+            lock.unlock();
+            task();
+            task = nullptr;
+            lock.lock();
+            continue;
+        }
+
+        if (state->stop)
+        {
+            break;
+        }
+
+        state->idle++;
+        bool woken = state->wakeUp.wait_for(lock, state->idleTimeout, [&state]
+                                            { return state->stop || !state->tasks.empty(); });
+        state->idle--;
+        if (!woken)
+        {
+            break;
+        }
+    }
+    state->threads--;
+}
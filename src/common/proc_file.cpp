@@ -0,0 +1,156 @@
+/**
+ * @file proc_file.cpp
+ * @brief procfs 파일 리더 구현
+ */
+
+#include "common/proc_file.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+/**
+ * @brief 리더 생성자
+ *
+ * @param path 읽을 파일 경로
+ * @param capacity 초기 버퍼 크기 (바이트)
+ */
+ProcFile::ProcFile(const char *path, size_t capacity)
+    : path_(path), buffer_(capacity > 0 ? capacity : 1)
+{
+}
+
+/**
+ * @brief 리더 소멸자 - 열린 fd를 닫음
+ */
+ProcFile::~ProcFile()
+{
+    if (fd_ >= 0)
+    {
+        close(fd_);
+    }
+}
+
+/**
+ * @brief 파일 전체를 처음부터 다시 읽음
+ *
+ * procfs의 seq_file은 오프셋 0에서 읽으면 내용을 새로 생성하므로 fd를 다시 열 필요가 없습니다.
+ * 버퍼가 가득 차면 두 배로 늘려 이어서 읽습니다.
+ *
+ * @return bool 성공하면 true
+ */
+bool ProcFile::read()
+{
+    if (fd_ < 0)
+    {
+        fd_ = open(path_, O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0)
+            return false;
+    }
+
+    size_ = 0;
+    while (true)
+    {
+        if (size_ == buffer_.size())
+        {
+            buffer_.resize(buffer_.size() * 2);
+        }
+
+        ssize_t n = pread(fd_, buffer_.data() + size_, buffer_.size() - size_, static_cast<off_t>(size_));
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            int saved = errno;
+            close(fd_);
+            fd_ = -1;
+            size_ = 0;
+            errno = saved;
+            return false;
+        }
+        if (n == 0)
+            return true;
+        size_ += static_cast<size_t>(n);
+    }
+}
+
+/**
+ * @brief 공백을 건너뛰고 부호 없는 10진 정수를 파싱
+ *
+ * @param p 파싱 시작 위치
+ * @param end 텍스트 끝
+ * @param value 파싱한 값
+ * @return const char* 숫자 바로 뒤 위치
+ */
+const char *ProcFile::parseUnsigned(const char *p, const char *end, uint64_t &value)
+{
+    while (p < end && (*p == ' ' || *p == '\t'))
+        p++;
+
+    value = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        value = value * 10 + static_cast<uint64_t>(*p - '0');
+        p++;
+    }
+    return p;
+}
+
+/**
+ * @brief 키-값 형식 텍스트에서 표에 지정된 키의 값을 찾아 저장
+ *
+ * 줄마다 표의 키와 접두사를 비교하며, 이미 찾은 키는 다시 비교하지 않습니다.
+ * 표는 작으므로(수십 개 이하) 선형 비교가 해시보다 빠릅니다.
+ *
+ * @param text 파싱할 텍스트
+ * @param fields 찾을 키 표
+ * @param count 표의 항목 수 (최대 64개, 넘는 항목은 무시)
+ * @return size_t 찾은 키 수
+ */
+size_t ProcFile::parseFields(string_view text, const ProcField *fields, size_t count)
+{
+    count = min<size_t>(count, 64);
+    const uint64_t all_mask = count == 64 ? ~uint64_t(0) : (uint64_t(1) << count) - 1;
+    uint64_t found_mask = 0;
+    size_t found = 0;
+
+    const char *p = text.data();
+    const char *end = p + text.size();
+    while (p < end && found_mask != all_mask)
+    {
+        const char *eol = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!eol)
+            eol = end;
+        string_view line(p, static_cast<size_t>(eol - p));
+
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64_t bit = uint64_t(1) << i;
+            if ((found_mask & bit) || line.compare(0, fields[i].key.size(), fields[i].key) != 0)
+                continue;
+
+            parseUnsigned(p + fields[i].key.size(), eol, *fields[i].value);
+            found_mask |= bit;
+            found++;
+            break;
+        }
+
+        p = eol + 1;
+    }
+    return found;
+}
+
+/**
+ * @brief 공유 /proc/stat 인스턴스 반환
+ *
+ * @return SharedProcFile& /proc/stat 리더
+ */
+SharedProcFile &SharedProcFile::stat()
+{
+    static SharedProcFile file("/proc/stat");
+    return file;
+}
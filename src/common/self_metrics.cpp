@@ -0,0 +1,392 @@
+/**
+ * @file self_metrics.cpp
+ * @brief 에이전트 자체 계측 레지스트리 구현
+ */
+
+#include "common/self_metrics.h"
+
+#include <algorithm>
+#include <ctime>
+#include <sys/resource.h>
+
+using namespace std;
+
+namespace
+{
+    /**
+     * @brief 큐 종류별 표시 이름
+     */
+    const char *const QUEUE_NAMES[] = {"metrics", "logs"};
+
+    /**
+     * @brief 현재 스레드에서 타이머들이 지금까지 기록한 CPU 시간
+     *
+     * 타이머가 끝날 때 자신의 CPU 시간만큼 늘어나므로, 바깥 타이머는 그 사이 증가분을 빼서
+     * 같은 스레드에서 직접 실행한 하위 작업의 CPU 시간을 두 번 세지 않습니다.
+     */
+    thread_local chrono::nanoseconds attributedCpu{0};
+
+    /**
+     * @brief 타이머 구간에서 중첩된 타이머가 기록한 부분을 뺀 CPU 시간을 계산하고 기록 완료로 표시합니다.
+     *
+     * @param cpuStart 구간 시작 시점의 스레드 CPU 시간
+     * @param attributedStart 구간 시작 시점의 attributedCpu
+     * @return chrono::nanoseconds 이 구간이 직접 소비한 CPU 시간
+     */
+    chrono::nanoseconds ownCpuTime(chrono::nanoseconds cpuStart, chrono::nanoseconds attributedStart)
+    {
+        chrono::nanoseconds own = (SelfMetrics::threadCpuTime() - cpuStart) - (attributedCpu - attributedStart);
+        own = max(own, chrono::nanoseconds(0));
+        attributedCpu += own;
+        return own;
+    }
+
+    /**
+     * @brief 원자 변수를 주어진 값 이상으로 갱신합니다.
+     *
+     * @param target 갱신할 원자 변수
+     * @param value 비교할 값
+     */
+    void updateMax(atomic<uint64_t> &target, uint64_t value)
+    {
+        uint64_t current = target.load(memory_order_relaxed);
+        while (value > current &&
+               !target.compare_exchange_weak(current, value, memory_order_relaxed))
+        {
+        }
+    }
+}
+
+/**
+ * @brief 타이머 생성자
+ *
+ * @param slot registerCollector()가 반환한 슬롯 번호
+ */
+SelfMetrics::Timer::Timer(int slot)
+    : slot_(slot), start_(chrono::steady_clock::now()), cpuStart_(SelfMetrics::threadCpuTime()),
+      attributedStart_(attributedCpu)
+{
+}
+
+/**
+ * @brief 타이머 소멸자
+ *
+ * 경과 시간과, 같은 스레드에서 실행된 하위 작업분을 뺀 스레드 CPU 시간을 레지스트리에 기록합니다.
+ */
+SelfMetrics::Timer::~Timer()
+{
+    SelfMetrics::instance().recordRun(slot_,
+                                      chrono::steady_clock::now() - start_,
+                                      ownCpuTime(cpuStart_, attributedStart_));
+}
+
+/**
+ * @brief 하위 작업 타이머 생성자
+ *
+ * @param slot 소유 수집기의 슬롯 번호
+ */
+SelfMetrics::SubTaskTimer::SubTaskTimer(int slot)
+    : slot_(slot), cpuStart_(SelfMetrics::threadCpuTime()), attributedStart_(attributedCpu)
+{
+}
+
+/**
+ * @brief 하위 작업 타이머 소멸자
+ *
+ * 하위 작업이 직접 소비한 CPU 시간을 소유 수집기에 더합니다.
+ */
+SelfMetrics::SubTaskTimer::~SubTaskTimer()
+{
+    SelfMetrics::instance().recordCpu(slot_, ownCpuTime(cpuStart_, attributedStart_));
+}
+
+/**
+ * @brief 전역 레지스트리 인스턴스 반환
+ *
+ * @return SelfMetrics& 레지스트리 인스턴스
+ */
+SelfMetrics &SelfMetrics::instance()
+{
+    static SelfMetrics registry;
+    return registry;
+}
+
+/**
+ * @brief 수집기 이름으로 슬롯을 등록하거나 기존 슬롯을 조회합니다.
+ *
+ * 같은 이름은 항상 같은 슬롯을 반환하므로 서버 모드와 ncurses 모드가
+ * 같은 이름으로 기록해도 통계가 합쳐집니다.
+ *
+ * @param name 수집기 이름
+ * @return int 슬롯 번호 (슬롯이 가득 찼으면 -1)
+ */
+int SelfMetrics::registerCollector(const string &name)
+{
+    lock_guard<mutex> lock(registerMutex_);
+
+    size_t count = slotCount_.load(memory_order_relaxed);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (names_[i] == name)
+        {
+            return static_cast<int>(i);
+        }
+    }
+
+    if (count >= MAX_COLLECTORS)
+    {
+        return -1;
+    }
+
+    names_[count] = name;
+    slotCount_.store(count + 1, memory_order_release);
+    return static_cast<int>(count);
+}
+
+/**
+ * @brief 소요 시간에 해당하는 히스토그램 칸 번호를 계산합니다.
+ *
+ * @param micros 소요 시간 (마이크로초)
+ * @return size_t 0번: 1ms 미만, i번: 2^(i-1)ms 이상 2^i ms 미만, 마지막 칸: 그 이상
+ */
+size_t SelfMetrics::bucketFor(uint64_t micros)
+{
+    uint64_t millis = micros / 1000;
+    size_t bucket = 0;
+    while (millis > 0 && bucket < LATENCY_BUCKETS - 1)
+    {
+        millis >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+/**
+ * @brief 수집기 실행 한 번의 결과를 기록합니다.
+ *
+ * @param slot 슬롯 번호 (음수이면 무시)
+ * @param elapsed 경과 시간
+ * @param cpuTime 실행 스레드에서 소비한 CPU 시간
+ */
+void SelfMetrics::recordRun(int slot, chrono::nanoseconds elapsed, chrono::nanoseconds cpuTime)
+{
+    if (slot < 0 || static_cast<size_t>(slot) >= MAX_COLLECTORS)
+    {
+        return;
+    }
+
+    CollectorSlot &target = slots_[static_cast<size_t>(slot)];
+    uint64_t micros = static_cast<uint64_t>(max<int64_t>(0, chrono::duration_cast<chrono::microseconds>(elapsed).count()));
+    uint64_t cpuMicros = static_cast<uint64_t>(max<int64_t>(0, chrono::duration_cast<chrono::microseconds>(cpuTime).count()));
+
+    target.runs.fetch_add(1, memory_order_relaxed);
+    target.totalMicros.fetch_add(micros, memory_order_relaxed);
+    target.cpuMicros.fetch_add(cpuMicros, memory_order_relaxed);
+    target.lastMicros.store(micros, memory_order_relaxed);
+    updateMax(target.maxMicros, micros);
+    target.histogram[bucketFor(micros)].fetch_add(1, memory_order_relaxed);
+}
+
+/**
+ * @brief 수집기 하위 작업이 소비한 CPU 시간을 더합니다.
+ *
+ * @param slot 슬롯 번호 (음수이면 무시)
+ * @param cpuTime 하위 작업을 실행한 스레드에서 소비한 CPU 시간
+ */
+void SelfMetrics::recordCpu(int slot, chrono::nanoseconds cpuTime)
+{
+    if (slot < 0 || static_cast<size_t>(slot) >= MAX_COLLECTORS)
+    {
+        return;
+    }
+
+    uint64_t cpuMicros = static_cast<uint64_t>(max<int64_t>(0, chrono::duration_cast<chrono::microseconds>(cpuTime).count()));
+    slots_[static_cast<size_t>(slot)].cpuMicros.fetch_add(cpuMicros, memory_order_relaxed);
+}
+
+/**
+ * @brief 수집기 오류를 기록합니다.
+ *
+ * @param slot 슬롯 번호 (음수이면 무시)
+ */
+void SelfMetrics::recordError(int slot)
+{
+    if (slot < 0 || static_cast<size_t>(slot) >= MAX_COLLECTORS)
+    {
+        return;
+    }
+    slots_[static_cast<size_t>(slot)].errors.fetch_add(1, memory_order_relaxed);
+}
+
+/**
+ * @brief 직렬화한 스냅샷 하나의 크기를 기록합니다.
+ *
+ * @param bytes 직렬화된 바이트 수
+ */
+void SelfMetrics::recordSerialized(size_t bytes)
+{
+    bytesSerialized_.fetch_add(bytes, memory_order_relaxed);
+    snapshotsSerialized_.fetch_add(1, memory_order_relaxed);
+}
+
+/**
+ * @brief 스케줄러가 건너뛴 틱 수를 기록합니다.
+ *
+ * @param ticks 건너뛴 틱 수
+ */
+void SelfMetrics::recordTickOverrun(uint64_t ticks)
+{
+    tickOverruns_.fetch_add(ticks, memory_order_relaxed);
+}
+
+/**
+ * @brief 발행 시점을 놓쳐 건너뛴 발행 주기 수를 기록합니다.
+ *
+ * @param cycles 건너뛴 발행 주기 수
+ */
+void SelfMetrics::recordMissedCycles(uint64_t cycles)
+{
+    missedCycles_.fetch_add(cycles, memory_order_relaxed);
+}
+
+/**
+ * @brief 내부 큐의 현재 깊이와 누적 드롭 수를 기록합니다.
+ *
+ * @param queue 큐 종류
+ * @param depth 현재 깊이
+ * @param dropped 가득 차서 버려지거나 대체된 누적 아이템 수
+ */
+void SelfMetrics::setQueueState(Queue queue, size_t depth, uint64_t dropped)
+{
+    queueDepths_[static_cast<size_t>(queue)].store(depth, memory_order_relaxed);
+    queueDrops_[static_cast<size_t>(queue)].store(dropped, memory_order_relaxed);
+}
+
+/**
+ * @brief 수집기의 현재 적용 중인 수집 주기를 기록합니다.
+ *
+ * @param slot 슬롯 번호 (음수이면 무시)
+ * @param period 변화량과 CPU 예산에 따라 조정된 수집 주기
+ */
+void SelfMetrics::setPeriod(int slot, chrono::milliseconds period)
+{
+    if (slot < 0 || static_cast<size_t>(slot) >= MAX_COLLECTORS)
+    {
+        return;
+    }
+    slots_[static_cast<size_t>(slot)].periodMs.store(static_cast<uint64_t>(period.count()), memory_order_relaxed);
+}
+
+/**
+ * @brief CPU 예산 초과로 모든 수집 주기에 곱해지는 배율을 기록합니다.
+ *
+ * @param scale 주기 배율 (1.0이면 예산 이내)
+ */
+void SelfMetrics::setRateScale(double scale)
+{
+    rateScale_.store(scale, memory_order_relaxed);
+}
+
+/**
+ * @brief 현재 스레드가 소비한 CPU 시간을 반환합니다.
+ *
+ * @return chrono::nanoseconds 스레드 CPU 시간 (조회 실패 시 0)
+ */
+chrono::nanoseconds SelfMetrics::threadCpuTime()
+{
+    timespec ts{};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+    {
+        return chrono::nanoseconds(0);
+    }
+    return chrono::seconds(ts.tv_sec) + chrono::nanoseconds(ts.tv_nsec);
+}
+
+/**
+ * @brief 에이전트 프로세스 전체가 소비한 CPU 시간을 반환합니다.
+ *
+ * @return chrono::nanoseconds getrusage(RUSAGE_SELF)의 사용자 + 커널 시간 (조회 실패 시 0)
+ */
+chrono::nanoseconds SelfMetrics::processCpuTime()
+{
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return chrono::nanoseconds(0);
+    }
+    return chrono::seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           chrono::microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+/**
+ * @brief 현재까지 기록된 지표를 AgentInfo로 반환합니다.
+ *
+ * 각 값은 개별적으로 원자적으로 읽으므로 기록과 동시에 호출되면
+ * 수집기 하나의 값들 사이에 실행 한 번 정도의 차이가 있을 수 있습니다.
+ *
+ * @return AgentInfo 에이전트 자체 지표
+ */
+AgentInfo SelfMetrics::snapshot() const
+{
+    AgentInfo info;
+
+    info.cpu_time_ms = chrono::duration<double, milli>(processCpuTime()).count();
+    info.rate_scale = rateScale_.load(memory_order_relaxed);
+
+    info.bytes_serialized = bytesSerialized_.load(memory_order_relaxed);
+    info.snapshots_serialized = snapshotsSerialized_.load(memory_order_relaxed);
+    info.tick_overruns = tickOverruns_.load(memory_order_relaxed);
+    info.missed_cycles = missedCycles_.load(memory_order_relaxed);
+
+    size_t count = slotCount_.load(memory_order_acquire);
+    info.collectors.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        const CollectorSlot &slot = slots_[i];
+        CollectorStats stats;
+        stats.name = names_[i];
+        stats.runs = slot.runs.load(memory_order_relaxed);
+        stats.errors = slot.errors.load(memory_order_relaxed);
+        stats.last_ms = static_cast<double>(slot.lastMicros.load(memory_order_relaxed)) / 1000.0;
+        stats.max_ms = static_cast<double>(slot.maxMicros.load(memory_order_relaxed)) / 1000.0;
+        stats.cpu_ms = static_cast<double>(slot.cpuMicros.load(memory_order_relaxed)) / 1000.0;
+        stats.period_ms = slot.periodMs.load(memory_order_relaxed);
+        if (stats.runs > 0)
+        {
+            stats.avg_ms = static_cast<double>(slot.totalMicros.load(memory_order_relaxed)) / 1000.0 /
+                           static_cast<double>(stats.runs);
+        }
+
+        stats.latency_histogram.resize(LATENCY_BUCKETS);
+        uint64_t total = 0;
+        for (size_t b = 0; b < LATENCY_BUCKETS; b++)
+        {
+            stats.latency_histogram[b] = slot.histogram[b].load(memory_order_relaxed);
+            total += stats.latency_histogram[b];
+        }
+
+        // 95 백분위가 속한 칸의 상한을 추정값으로 사용 (마지막 칸은 최대값)
+        uint64_t threshold = (total * 95 + 99) / 100;
+        uint64_t seen = 0;
+        for (size_t b = 0; b < LATENCY_BUCKETS && total > 0; b++)
+        {
+            seen += stats.latency_histogram[b];
+            if (seen >= threshold)
+            {
+                stats.p95_ms = (b == LATENCY_BUCKETS - 1) ? stats.max_ms
+                                                          : min(stats.max_ms, static_cast<double>(uint64_t(1) << b));
+                break;
+            }
+        }
+
+        info.collectors.push_back(move(stats));
+    }
+
+    for (size_t q = 0; q < static_cast<size_t>(Queue::Count); q++)
+    {
+        info.queues.push_back({QUEUE_NAMES[q], queueDepths_[q].load(memory_order_relaxed),
+                               queueDrops_[q].load(memory_order_relaxed)});
+    }
+
+    return info;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file string_pool.cpp
+ * @brief 프로세스 전역 문자열 인터닝 풀 구현
+ */
+
+#include "common/string_pool.h"
+
+#include <mutex>
+
+using namespace std;
+
+/**
+ * @brief 전역 풀 인스턴스 반환
+ *
+ * @return StringPool& 풀 인스턴스
+ */
+StringPool &StringPool::instance()
+{
+    static StringPool pool;
+    return pool;
+}
+
+/**
+ * @brief 문자열을 풀에 저장하고 풀 안의 사본을 가리키는 뷰를 반환
+ *
+ * 대부분의 호출은 이미 저장된 값이므로 공유 잠금으로 먼저 조회하고,
+ * 없을 때만 배타 잠금을 잡아 다시 확인한 뒤 추가합니다.
+ *
+ * @param value 저장할 문자열
+ * @return string_view 풀에 저장된 사본
+ */
+string_view StringPool::intern(string_view value)
+{
+    {
+        shared_lock<shared_mutex> lock(mutex_);
+        auto it = index_.find(value);
+        if (it != index_.end())
+            return *it;
+    }
+
+    unique_lock<shared_mutex> lock(mutex_);
+    auto it = index_.find(value);
+    if (it != index_.end())
+        return *it;
+
+    const string &stored = storage_.emplace_back(value);
+    string_view view(stored);
+    index_.insert(view);
+    return view;
+}
+
+/**
+ * @brief 풀에 저장된 문자열 수 반환
+ *
+ * @return size_t 저장된 문자열 수
+ */
+size_t StringPool::size() const
+{
+    shared_lock<shared_mutex> lock(mutex_);
+    return storage_.size();
+}
@@ -0,0 +1,258 @@
+/**
+ * @file worker_pool.cpp
+ * @brief 작업 훔치기 방식 작업자 풀 구현
+ */
+
+#include "common/worker_pool.h"
+#include <algorithm>
+#include <iterator>
+
+using namespace std;
+
+namespace
+{
+    /**
+     * @brief 현재 스레드가 속한 작업자 풀 (작업자 스레드가 아니면 nullptr)
+     */
+    thread_local const void *currentPool = nullptr;
+
+    /**
+     * @brief 현재 스레드의 작업자 번호
+     */
+    thread_local size_t currentIndex = 0;
+
+    /**
+     * @brief 현재 스레드에서 실행 중인 작업의 식별자 (실행 중인 작업이 없으면 0)
+     */
+    thread_local uint64_t currentTask = 0;
+}
+
+/**
+ * @brief 작업자 풀 생성자
+ *
+ * @param threadCount 작업자 스레드 수 (0이면 defaultThreadCount() 사용)
+ */
+WorkerPool::WorkerPool(size_t threadCount)
+    : stop_(false), pending_(0), nextTaskId_(1)
+{
+    if (threadCount == 0)
+    {
+        threadCount = defaultThreadCount();
+    }
+
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        queues_.push_back(make_unique<WorkQueue>());
+    }
+
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        workers_.emplace_back(&WorkerPool::workerLoop, this, i);
+    }
+}
+
+/**
+ * @brief 작업자 풀 소멸자
+ *
+ * 대기 중인 작업은 폐기하고 모든 작업자 스레드를 종료합니다.
+ * 폐기된 작업의 future는 broken_promise 예외로 완료됩니다.
+ */
+WorkerPool::~WorkerPool()
+{
+    {
+        lock_guard<mutex> lock(sleepMutex_);
+        stop_ = true;
+    }
+    wakeUp_.notify_all();
+
+    for (auto &worker : workers_)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    for (auto &queue : queues_)
+    {
+        lock_guard<mutex> lock(queue->queueMutex);
+        queue->tasks.clear();
+    }
+
+    lock_guard<mutex> lock(injection_.queueMutex);
+    injection_.tasks.clear();
+}
+
+/**
+ * @brief 기본 작업자 스레드 수 반환
+ *
+ * @return size_t 하드웨어 스레드 수와 4 중 작은 값 (최소 1)
+ */
+size_t WorkerPool::defaultThreadCount()
+{
+    size_t hardware = thread::hardware_concurrency();
+    return max<size_t>(1, min<size_t>(hardware, 4));
+}
+
+/**
+ * @brief 작업을 큐에 추가하고 유휴 작업자를 깨웁니다.
+ *
+ * 작업자 스레드에서 실행 중인 작업이 제출한 하위 작업은 해당 작업자의 큐에 넣고
+ * 제출한 작업의 식별자를 기록합니다. 외부 스레드에서 제출한 작업은 주입 큐에 넣으므로
+ * 다른 작업을 기다리는 작업자가 이를 대신 실행하는 일이 없습니다.
+ *
+ * @param task 추가할 작업
+ */
+void WorkerPool::push(function<void()> task)
+{
+    const bool local = currentPool == this;
+    Task entry;
+    entry.run = move(task);
+    entry.id = nextTaskId_.fetch_add(1);
+    entry.owner = local ? currentTask : 0;
+
+    // 작업이 큐에 보이기 전에 pending_을 올려야 다른 작업자가 먼저 꺼내 감소시켜도 0 아래로 내려가지 않음
+    WorkQueue &queue = local ? *queues_[currentIndex] : injection_;
+    {
+        lock_guard<mutex> lock(queue.queueMutex);
+        pending_++;
+        queue.tasks.push_back(move(entry));
+    }
+
+    // 유휴 작업자가 조건 확인과 대기 사이에 알림을 놓치지 않도록 sleepMutex_를 거친 뒤 깨움
+    {
+        lock_guard<mutex> lock(sleepMutex_);
+    }
+    wakeUp_.notify_one();
+}
+
+/**
+ * @brief 자신의 큐, 주입 큐, 다른 작업자의 큐 순서로 작업을 가져옵니다.
+ *
+ * 자신의 큐는 가장 최근 작업부터(LIFO), 주입 큐와 다른 큐는 가장 오래된 작업부터(FIFO) 가져옵니다.
+ *
+ * @param index 작업자 번호
+ * @param task 가져온 작업을 저장할 참조
+ * @return bool 작업을 가져왔으면 true
+ */
+bool WorkerPool::takeTask(size_t index, Task &task)
+{
+    {
+        WorkQueue &own = *queues_[index];
+        lock_guard<mutex> lock(own.queueMutex);
+        if (!own.tasks.empty())
+        {
+            task = move(own.tasks.back());
+            own.tasks.pop_back();
+            pending_--;
+            return true;
+        }
+    }
+
+    {
+        lock_guard<mutex> lock(injection_.queueMutex);
+        if (!injection_.tasks.empty())
+        {
+            task = move(injection_.tasks.front());
+            injection_.tasks.pop_front();
+            pending_--;
+            return true;
+        }
+    }
+
+    for (size_t offset = 1; offset < queues_.size(); offset++)
+    {
+        WorkQueue &victim = *queues_[(index + offset) % queues_.size()];
+        lock_guard<mutex> lock(victim.queueMutex);
+        if (!victim.tasks.empty())
+        {
+            task = move(victim.tasks.front());
+            victim.tasks.pop_front();
+            pending_--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief 현재 작업 식별자를 설정한 채 작업을 실행합니다.
+ *
+ * 작업 안에서 제출한 하위 작업에 이 식별자가 소유자로 기록됩니다.
+ *
+ * @param task 실행할 작업
+ */
+void WorkerPool::execute(Task &task)
+{
+    const uint64_t previous = currentTask;
+    currentTask = task.id;
+    task.run();
+    currentTask = previous;
+}
+
+/**
+ * @brief 현재 작업이 제출한 하위 작업 하나를 자신의 큐에서 꺼내 실행합니다.
+ *
+ * 대기 중인 작업이 자신이 제출한 하위 작업만 직접 처리하도록, 큐의 뒤쪽부터 소유자가
+ * 현재 작업인 항목을 찾습니다. 바깥에서 대기 중인 작업의 하위 작업은 건너뜁니다.
+ *
+ * @return bool 작업을 실행했으면 true (작업자 스레드에서 실행 중인 작업이 아니면 항상 false)
+ */
+bool WorkerPool::runLocalTask()
+{
+    if (currentPool != this || currentTask == 0)
+    {
+        return false;
+    }
+
+    Task task;
+    {
+        WorkQueue &own = *queues_[currentIndex];
+        lock_guard<mutex> lock(own.queueMutex);
+        auto it = find_if(own.tasks.rbegin(), own.tasks.rend(), [](const Task &queued)
+                          { return queued.owner == currentTask; });
+        if (it == own.tasks.rend())
+        {
+            return false;
+        }
+        task = move(*it);
+        own.tasks.erase(next(it).base());
+        pending_--;
+    }
+
+    execute(task);
+    return true;
+}
+
+/**
+ * @brief 작업자 스레드 메인 루프
+ *
+ * 실행할 작업이 없으면 새 작업이 제출되거나 종료 신호가 올 때까지 대기합니다.
+ *
+ * @param index 작업자 번호
+ */
+void WorkerPool::workerLoop(size_t index)
+{
+    currentPool = this;
+    currentIndex = index;
+
+    while (true)
+    {
+        Task task;
+        if (takeTask(index, task))
+        {
+            execute(task);
+            continue;
+        }
+
+        unique_lock<mutex> lock(sleepMutex_);
+        wakeUp_.wait(lock, [this]
+                     { return stop_ || pending_ > 0; });
+
+        if (stop_)
+        {
+            return;
+        }
+    }
+}
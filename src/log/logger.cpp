@@ -6,6 +6,7 @@
  */
 
 #include "log/logger.h"
+#include "common/queue_factory.h"
 #include <filesystem>
 #include <iostream>
 #include <time.h>
@@ -28,9 +29,9 @@ unique_ptr<LogSender> Logger::s_logSender;
 
 /**
  * @brief 로그 큐의 정적 인스턴스
- * @details 로그 데이터를 저장하는 스레드 안전 큐입니다.
+ * @details 로그 데이터를 저장하는 큐입니다. 원격 로깅 초기화 시 옵션에 맞는 구현으로 생성됩니다.
  */
-ThreadSafeQueue<LogType> Logger::s_logQueue(1000); // 로그 큐 크기 1000
+unique_ptr<BoundedQueue<LogType>> Logger::s_logQueue;
 
 /**
  * @brief 원격 로깅 활성화 상태 플래그
@@ -99,19 +100,24 @@ void Logger::init()
  * @param serverInfo 원격 로깅 서버 정보
  * @param nodeId 노드 식별자
  * @param intervalSeconds 로그 전송 간격 (초)
+ * @param queueOptions 로그 큐 구현과 가득 찼을 때 동작
  * @details 기본 로깅 시스템을 초기화하고 원격 로깅을 설정합니다.
+ *          캡처 싱크는 spdlog 싱크 뮤텍스로 직렬화되므로 로그 큐의 생산자는 항상 하나입니다.
  * @throws spdlog::spdlog_ex 로거 초기화 실패 시 예외 발생
  */
-void Logger::initWithRemoteLogging(const ServerInfo &serverInfo, const string &nodeId, int intervalSeconds)
+void Logger::initWithRemoteLogging(const ServerInfo &serverInfo, const string &nodeId, int intervalSeconds,
+                                   const QueueOptions &queueOptions)
 {
     try
     {
+        s_logQueue = makeBoundedQueue<LogType>(1000, queueOptions); // 로그 큐 크기 1000
+
         // 캡처 싱크 추가
-        auto captureSink = make_shared<LogCaptureSinkMt>(s_logQueue, nodeId);
+        auto captureSink = make_shared<LogCaptureSinkMt>(*s_logQueue, nodeId);
         s_logger->sinks().push_back(captureSink);
 
         // 로그 전송기 생성 및 시작
-        s_logSender = make_unique<LogSender>(serverInfo, s_logQueue);
+        s_logSender = make_unique<LogSender>(serverInfo, *s_logQueue);
         if (s_logSender->connect())
         {
             s_logSender->startSending(intervalSeconds); // 5초 간격으로 전송
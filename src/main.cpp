@@ -20,8 +20,15 @@
 #include "network/common/network_types.h"
 #include "network/client/system_client.h"
 #include "config/config.h"
+#include "config/collector_options.h"
 #include "log/logger.h"
 #include <atomic>
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include <cctype>
+#include <limits>
+#include <stdexcept>
 
 using namespace std;
 
@@ -89,6 +96,9 @@ int main(int argc, char **argv)
     /** @brief 서버 연결 정보 */
     ServerInfo serverInfo;
 
+    /** @brief 수집기 실행 옵션 */
+    CollectorOptions collectorOptions;
+
     /** @brief 설정 관리 객체 */
     Config config;
     /** @brief 시스템 식별 키 */
@@ -132,6 +142,24 @@ int main(int argc, char **argv)
                  << "  -c, --collection     수집 간격 (초, 기본값: 5)\n"
                  << "  -t, --transmission   전송 간격 (초, 기본값: 5)\n"
                  << "  -l, --log            로그 전송 간격 (초, 기본값: 5)\n"
+                 << "  -p, --period         수집기별 수집 주기 (이름=초, 예: docker=30, 반복 지정 가능)\n"
+                 << "  -w, --workers        수집 작업자 스레드 수 (기본값: CPU 코어 수, 최대 4)\n"
+                 << "  -d, --deadline       주기별 수집 대기 허용 시간 (밀리초, 기본값: 수집 간격의 절반, 최대 1000)\n"
+                 << "  -j, --jitter         호스트별 발행 시점 지터 최대값 (밀리초, 기본값: 0)\n"
+                 << "  -a, --adaptive-rate  변화량에 따른 수집 주기 자동 조정 켜기 (기본값: 끔)\n"
+                 << "  -b, --cpu-budget     에이전트 CPU 사용률 예산 (%, 초과 시 수집 주기를 늘림, 기본값: 0=제한 없음)\n"
+                 << "      --proc-io        I/O 통계를 수집할 프로세스 수 (N=CPU 상위 N개, all, off, 기본값: all, --proc-groups 사용 시 N은 all로 동작)\n"
+                 << "      --proc-fds       열린 파일 수를 셀 프로세스 수 (N=CPU 상위 N개, all, off, 기본값: all)\n"
+                 << "      --top            내보낼 상위 프로세스 수 (기본값: 0=전체)\n"
+                 << "      --top-by         상위 프로세스 기준 (cpu, rss, io, 기본값: cpu)\n"
+                 << "      --include        순위와 관계없이 항상 포함할 프로세스 (PID 또는 이름, 쉼표 구분)\n"
+                 << "      --proc-groups    프로세스 합산 정보 생성 (tree, cgroup, 쉼표 구분)\n"
+                 << "      --threads        스레드별 CPU 사용량을 수집할 프로세스 (PID 또는 이름, 쉼표 구분)\n"
+                 << "      --proc-events    netlink로 프로세스 생성/실행/종료 이벤트 수신 (CAP_NET_ADMIN 필요, 없으면 폴링)\n"
+                 << "  -e, --enable         실행할 수집기 목록 (쉼표 구분, 예: cpu,memory,disk)\n"
+                 << "  -x, --disable        실행하지 않을 수집기 목록 (쉼표 구분, 예: docker,service)\n"
+                 << "  -q, --queue          메트릭/로그 큐 구현 (mutex, spsc, 기본값: mutex)\n"
+                 << "  -o, --overflow       큐가 가득 찼을 때 동작 (drop-oldest, drop-newest, coalesce, block, 기본값: drop-oldest)\n"
                  << "  -h, --help          이 도움말 표시\n";
             return 0;
         }
@@ -180,6 +208,295 @@ int main(int argc, char **argv)
                 }
             }
         }
+        else if (arg == "-p" || arg == "--period")
+        {
+            if (i + 1 < argc)
+            {
+                string period = argv[++i];
+                size_t equalPos = period.find('=');
+                try
+                {
+                    if (equalPos == string::npos)
+                    {
+                        throw invalid_argument(period);
+                    }
+                    collectorOptions.periods[period.substr(0, equalPos)] = stoi(period.substr(equalPos + 1));
+                }
+                catch (const exception &e)
+                {
+                    cerr << "잘못된 수집 주기 값입니다 (이름=초 형식 사용): " << period << "\n";
+                }
+            }
+        }
+        else if (arg == "-w" || arg == "--workers")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    int workers = stoi(argv[++i]);
+                    if (workers <= 0)
+                    {
+                        throw invalid_argument(argv[i]);
+                    }
+                    collectorOptions.workerThreads = static_cast<size_t>(workers);
+                }
+                catch (const exception &e)
+                {
+                    cerr << "잘못된 작업자 스레드 수입니다. 기본값을 사용합니다.\n";
+                    collectorOptions.workerThreads = 0;
+                }
+            }
+        }
+        else if (arg == "-d" || arg == "--deadline")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    collectorOptions.cycleDeadlineMs = stoi(argv[++i]);
+                }
+                catch (const exception &e)
+                {
+                    cerr << "잘못된 수집 대기 허용 시간입니다. 기본값을 사용합니다.\n";
+                    collectorOptions.cycleDeadlineMs = 0;
+                }
+            }
+        }
+        else if (arg == "-j" || arg == "--jitter")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    collectorOptions.jitterMs = max(0, stoi(argv[++i]));
+                }
+                catch (const exception &e)
+                {
+                    cerr << "잘못된 지터 값입니다. 지터 없이 실행합니다.\n";
+                    collectorOptions.jitterMs = 0;
+                }
+            }
+        }
+        else if (arg == "-a" || arg == "--adaptive-rate")
+        {
+            collectorOptions.adaptiveRate = true;
+        }
+        else if (arg == "-b" || arg == "--cpu-budget")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    collectorOptions.cpuBudgetPercent = max(0.0, stod(argv[++i]));
+                }
+                catch (const exception &e)
+                {
+                    cerr << "잘못된 CPU 예산입니다. 제한 없이 실행합니다.\n";
+                    collectorOptions.cpuBudgetPercent = 0.0;
+                }
+            }
+        }
+        else if (arg == "--proc-io" || arg == "--proc-fds")
+        {
+            if (i + 1 < argc)
+            {
+                int &limit = (arg == "--proc-io") ? collectorOptions.process.ioLimit : collectorOptions.process.fdLimit;
+                string value = argv[++i];
+                try
+                {
+                    if (value == "all")
+                    {
+                        limit = -1;
+                    }
+                    else if (value == "off")
+                    {
+                        limit = 0;
+                    }
+                    else
+                    {
+                        limit = stoi(value);
+                        if (limit < 0)
+                        {
+                            throw invalid_argument(value);
+                        }
+                    }
+                }
+                catch (const exception &e)
+                {
+                    cerr << "잘못된 프로세스 수입니다 (N, all, off 중 하나 사용): " << value << "\n";
+                    limit = -1;
+                }
+            }
+        }
+        else if (arg == "--top")
+        {
+            if (i + 1 < argc)
+            {
+                try
+                {
+                    collectorOptions.process.topK = static_cast<size_t>(max(0, stoi(argv[++i])));
+                }
+                catch (const exception &e)
+                {
+                    cerr << "잘못된 상위 프로세스 수입니다. 전체 프로세스를 내보냅니다.\n";
+                    collectorOptions.process.topK = 0;
+                }
+            }
+        }
+        else if (arg == "--top-by")
+        {
+            if (i + 1 < argc)
+            {
+                string rank = argv[++i];
+                if (rank == "cpu")
+                {
+                    collectorOptions.process.rankBy = ProcessRank::Cpu;
+                }
+                else if (rank == "rss")
+                {
+                    collectorOptions.process.rankBy = ProcessRank::Memory;
+                }
+                else if (rank == "io")
+                {
+                    collectorOptions.process.rankBy = ProcessRank::Io;
+                }
+                else
+                {
+                    cerr << "잘못된 상위 프로세스 기준입니다 (cpu, rss, io). 기본값(cpu)을 사용합니다.\n";
+                }
+            }
+        }
+        else if (arg == "--include" || arg == "--threads")
+        {
+            if (i + 1 < argc)
+            {
+                bool include = (arg == "--include");
+                set<pid_t> &pids = include ? collectorOptions.process.includePids : collectorOptions.process.threadPids;
+                set<string, less<>> &names = include ? collectorOptions.process.includeNames
+                                                     : collectorOptions.process.threadNames;
+                stringstream list(argv[++i]);
+                string item;
+                while (getline(list, item, ','))
+                {
+                    if (item.empty())
+                    {
+                        continue;
+                    }
+                    if (all_of(item.begin(), item.end(), [](unsigned char c)
+                               { return isdigit(c) != 0; }))
+                    {
+                        try
+                        {
+                            long pid = stol(item);
+                            if (pid <= 0 || pid > numeric_limits<pid_t>::max())
+                            {
+                                throw out_of_range(item);
+                            }
+                            pids.insert(static_cast<pid_t>(pid));
+                        }
+                        catch (const exception &e)
+                        {
+                            cerr << "잘못된 PID입니다. 무시합니다: " << item << "\n";
+                        }
+                    }
+                    else
+                    {
+                        names.insert(item);
+                    }
+                }
+            }
+        }
+        else if (arg == "--proc-events")
+        {
+            collectorOptions.process.processEvents = true;
+        }
+        else if (arg == "--proc-groups")
+        {
+            if (i + 1 < argc)
+            {
+                stringstream list(argv[++i]);
+                string group;
+                while (getline(list, group, ','))
+                {
+                    if (group == "tree")
+                    {
+                        collectorOptions.process.groupTrees = true;
+                    }
+                    else if (group == "cgroup")
+                    {
+                        collectorOptions.process.groupCgroups = true;
+                    }
+                    else if (!group.empty())
+                    {
+                        cerr << "알 수 없는 프로세스 합산 단위입니다 (tree, cgroup): " << group << "\n";
+                    }
+                }
+            }
+        }
+        else if (arg == "-e" || arg == "--enable" || arg == "-x" || arg == "--disable")
+        {
+            if (i + 1 < argc)
+            {
+                set<string> &names = (arg == "-e" || arg == "--enable") ? collectorOptions.enabledCollectors
+                                                                         : collectorOptions.disabledCollectors;
+                stringstream list(argv[++i]);
+                string name;
+                while (getline(list, name, ','))
+                {
+                    if (!name.empty())
+                    {
+                        names.insert(name);
+                    }
+                }
+            }
+        }
+        else if (arg == "-q" || arg == "--queue")
+        {
+            if (i + 1 < argc)
+            {
+                string kind = argv[++i];
+                if (kind == "mutex")
+                {
+                    collectorOptions.queue.kind = QueueKind::Mutex;
+                }
+                else if (kind == "spsc")
+                {
+                    collectorOptions.queue.kind = QueueKind::Spsc;
+                }
+                else
+                {
+                    cerr << "잘못된 큐 구현입니다 (mutex, spsc). 기본값(mutex)을 사용합니다.\n";
+                }
+            }
+        }
+        else if (arg == "-o" || arg == "--overflow")
+        {
+            if (i + 1 < argc)
+            {
+                string policy = argv[++i];
+                if (policy == "block")
+                {
+                    collectorOptions.queue.overflow = OverflowPolicy::Block;
+                }
+                else if (policy == "drop-oldest")
+                {
+                    collectorOptions.queue.overflow = OverflowPolicy::DropOldest;
+                }
+                else if (policy == "drop-newest")
+                {
+                    collectorOptions.queue.overflow = OverflowPolicy::DropNewest;
+                }
+                else if (policy == "coalesce")
+                {
+                    collectorOptions.queue.overflow = OverflowPolicy::Coalesce;
+                }
+                else
+                {
+                    cerr << "잘못된 큐 가득 참 동작입니다 (drop-oldest, drop-newest, coalesce, block). 기본값(drop-oldest)을 사용합니다.\n";
+                }
+            }
+        }
         else if (arg == "-s" || arg == "--server")
         {
             if (i + 1 < argc)
@@ -223,10 +540,10 @@ int main(int argc, char **argv)
         try
         {
             // 원격 로깅 활성화
-            Logger::initWithRemoteLogging(serverInfo, systemKey, logSendingInterval);
+            Logger::initWithRemoteLogging(serverInfo, systemKey, logSendingInterval, collectorOptions.queue);
 
             /** @brief 서버 클라이언트 초기화 및 연결 */
-            systemClient = make_unique<SystemClient>(serverInfo, systemKey, collectionInterval, sendingInterval, user_id);
+            systemClient = make_unique<SystemClient>(serverInfo, systemKey, collectionInterval, sendingInterval, user_id, collectorOptions);
             systemClient->connect();
 
             /** @brief 프로그램 실행 유지 루프 */
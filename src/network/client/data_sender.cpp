@@ -1,5 +1,6 @@
 #include "network/client/data_sender.h"
 #include "log/logger.h"
+#include "common/self_metrics.h"
 #include "commands/command_executor.h"
 #include <iostream>
 #include <nlohmann/json.hpp>
@@ -16,9 +17,11 @@ extern atomic<bool> running;
  * @param serverInfo 연결할 서버 정보 (주소, 포트)
  * @param dataQueue 전송할 시스템 메트릭 데이터를 저장하는 스레드 안전 큐
  * @param user_id 사용자 식별자
+ * @param recycleQueue 전송을 마친 메트릭을 돌려보낼 재사용 큐 (nullptr이면 돌려보내지 않음)
  */
-DataSender::DataSender(const ServerInfo &serverInfo, ThreadSafeQueue<SystemMetrics> &dataQueue, const string &user_id)
-    : serverInfo_(serverInfo), dataQueue_(dataQueue), commandResultQueue_(100), commandQueue_(100),
+DataSender::DataSender(const ServerInfo &serverInfo, BoundedQueue<SystemMetrics> &dataQueue, const string &user_id,
+                       BoundedQueue<SystemMetrics> *recycleQueue)
+    : serverInfo_(serverInfo), dataQueue_(dataQueue), recycleQueue_(recycleQueue), commandResultQueue_(100), commandQueue_(100),
       user_id_(user_id), isConnected_(false), running_(false), numWorkers_(4)
 {
     // WebSocket 클라이언트 초기화
@@ -197,6 +200,7 @@ void DataSender::stopSending()
  * @brief 데이터 전송 루프를 실행하는 메서드
  *
  * 지정된 간격으로 큐에서 시스템 메트릭 데이터를 가져와 서버로 전송합니다.
+ * 전송을 마친 메트릭은 재사용 큐로 돌려보내 수집기 관리자가 버퍼를 재사용하게 합니다.
  *
  * @param intervalSeconds 전송 간격(초)
  */
@@ -211,8 +215,14 @@ void DataSender::sendLoop(int intervalSeconds)
         SystemMetrics metrics;
         if (dataQueue_.try_pop(metrics, chrono::milliseconds(100)))
         {
+            SelfMetrics::instance().setQueueState(SelfMetrics::Queue::Metrics, dataQueue_.size(), dataQueue_.dropped());
             metrics.user_id = user_id_;
             sendMetrics(metrics);
+
+            if (recycleQueue_)
+            {
+                recycleQueue_->try_push(move(metrics));
+            }
         }
 
         // 송신 간격 조절
@@ -295,6 +305,7 @@ bool DataSender::sendMetrics(const SystemMetrics &metrics)
 
     // 최종 JSON을 문자열로 변환
     string data = metricsObj.dump();
+    SelfMetrics::instance().recordSerialized(data.size());
 
     // WebSocket으로 전송
     websocketpp::lib::error_code ec;
@@ -1,5 +1,6 @@
 #include "network/client/log_sender.h"
 #include "log/logger.h"
+#include "common/self_metrics.h"
 #include <iostream>
 #include <nlohmann/json.hpp>
 
@@ -8,7 +9,7 @@ using json = nlohmann::json;
 
 extern atomic<bool> running;
 
-LogSender::LogSender(const ServerInfo &serverInfo, ThreadSafeQueue<LogType> &logQueue)
+LogSender::LogSender(const ServerInfo &serverInfo, BoundedQueue<LogType> &logQueue)
     : serverInfo_(serverInfo), logQueue_(logQueue),
       isConnected_(false)
 {
@@ -119,8 +120,10 @@ void LogSender::sendLoop(int intervalSeconds)
         vector<LogType> logs;
         LogType log;
 
-        // 큐 상태 로깅 추가
-        LOG_DEBUG("로그 큐 상태: 크기={}", logQueue_.size());
+        // 큐 상태 기록
+        size_t queueDepth = logQueue_.size();
+        SelfMetrics::instance().setQueueState(SelfMetrics::Queue::Logs, queueDepth, logQueue_.dropped());
+        LOG_DEBUG("로그 큐 상태: 크기={}", queueDepth);
 
         // 최대 100개까지 로그를 모음
         int fetched = 0;
@@ -28,13 +28,15 @@ bool isDisconnected_ = false;
  * @param collectionInterval 메트릭 수집 간격(초)
  * @param sendingInterval 데이터 전송 간격(초)
  * @param user_id 사용자 ID
+ * @param collectorOptions 수집기 실행 옵션
  *
  * @details 시스템 클라이언트를 초기화하고 CollectorManager와 DataSender를 설정합니다.
  */
 SystemClient::SystemClient(const ServerInfo &serverInfo, const string &systemKey,
-                           int collectionInterval, int sendingInterval, const string &user_id)
+                           int collectionInterval, int sendingInterval, const string &user_id,
+                           const CollectorOptions &collectorOptions)
     : serverInfo_(serverInfo), systemKey_(systemKey), user_id_(user_id),
-      collectionInterval_(collectionInterval), sendingInterval_(sendingInterval)
+      collectorOptions_(collectorOptions), collectionInterval_(collectionInterval), sendingInterval_(sendingInterval)
 {
     // 시작 시간 기록
     auto startTime = chrono::system_clock::now();
@@ -45,10 +47,11 @@ SystemClient::SystemClient(const ServerInfo &serverInfo, const string &systemKey
     LOG_INFO("시스템 클라이언트 초기화 시작: {}", startTimestamp);
 
     // 수집 관리자 초기화
-    collectorManager_ = make_unique<CollectorManager>(systemKey_);
+    collectorManager_ = make_unique<CollectorManager>(systemKey_, collectorOptions_);
 
     // 데이터 송신기 초기화
-    dataSender_ = make_unique<DataSender>(serverInfo_, collectorManager_->getDataQueue(), user_id_);
+    dataSender_ = make_unique<DataSender>(serverInfo_, collectorManager_->getDataQueue(), user_id_,
+                                         &collectorManager_->getRecycleQueue());
 
     // 종료 시간 기록 및 소요 시간 출력
     auto endTime = chrono::system_clock::now();
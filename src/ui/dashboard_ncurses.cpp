@@ -12,6 +12,7 @@
 #include "collectors/disk_collector.h"
 #include "collectors/systeminfo_collector.h"
 #include "collectors/process_collector.h"
+#include "common/self_metrics.h"
 #include <iostream>
 #include <iomanip>
 #include <cstdlib>
@@ -22,6 +23,23 @@
 #include <locale.h>
 #include <stdlib.h>
 
+namespace
+{
+    /**
+     * @brief 수집기를 실행하고 소요 시간을 자체 계측 레지스트리에 기록합니다.
+     *
+     * @tparam CollectorType 수집기 타입
+     * @param collector 실행할 수집기
+     * @param name 레지스트리에 기록할 수집기 이름
+     */
+    template <typename CollectorType>
+    void collectTimed(CollectorType &collector, const string &name)
+    {
+        SelfMetrics::Timer timer(SelfMetrics::instance().registerCollector(name));
+        collector.collect();
+    }
+}
+
 /**
  * @brief DashboardNcurses 클래스의 생성자
  *
@@ -106,15 +124,15 @@ void DashboardNcurses::clearScreen()
 void DashboardNcurses::updateMonitor()
 {
     LOG_INFO("UPDATE MONITOR");
-    cpu_collector.collect();
-    memory_collector.collect();
-    disk_collector.collect();
-    network_collector.collect();
+    collectTimed(cpu_collector, "cpu");
+    collectTimed(memory_collector, "memory");
+    collectTimed(disk_collector, "disk");
+    collectTimed(network_collector, "network");
 
     system_metrics.cpu = cpu_collector.getCpuInfo();
     system_metrics.memory = memory_collector.getMemoryInfo();
     system_metrics.disk = disk_collector.getDiskStats();
-    system_metrics.network = network_collector.getInterfacesToVector();
+    network_collector.getInterfacesToVector(system_metrics.network);
 
     // 테두리 (청록색)
     attron(COLOR_PAIR(1));
@@ -133,6 +151,10 @@ void DashboardNcurses::updateMonitor()
     mvprintw(row++, 0, "전체 CPU 사용량: %.1f%% %.1f°C", system_metrics.cpu.usage, system_metrics.cpu.temperature);
     attroff(COLOR_PAIR(color));
 
+    const CpuTimes &times = system_metrics.cpu.times;
+    mvprintw(row++, 0, "usr %.1f%% | sys %.1f%% | iowait %.1f%% | irq %.1f%% | softirq %.1f%% | steal %.1f%%",
+             times.user + times.nice, times.system, times.iowait, times.irq, times.softirq, times.steal);
+
     for (size_t i = 0; i < system_metrics.cpu.cores.size(); i += 4)
     {
         std::string line;
@@ -219,7 +241,7 @@ void DashboardNcurses::updateMonitor()
 void DashboardNcurses::updateSystemInfo()
 {
     LOG_INFO("UPDATE SYSTEM INFO");
-    systeminfo_collector.collect();
+    collectTimed(systeminfo_collector, "system");
     const SystemInfo &sys_info = systeminfo_collector.getSystemInfo();
 
     // 시스템 정보 헤더 (청록색)
@@ -258,8 +280,9 @@ void DashboardNcurses::updateProcesses()
 {
     LOG_INFO("UPDATE PROCESSES");
 
-    process_collector.collect();
-    const std::vector<ProcessInfo> &processes = process_collector.getProcesses(sort_by);
+    collectTimed(process_collector, "process");
+    process_collector.getProcesses(sort_by, system_metrics.process);
+    const std::vector<ProcessInfo> &processes = system_metrics.process;
 
     // 프로세스 정보 헤더 (청록색)
     attron(COLOR_PAIR(1));
@@ -316,7 +339,7 @@ void DashboardNcurses::updateProcesses()
 
     // 헤더 (자주색)
     attron(COLOR_PAIR(6));
-    mvprintw(row++, 0, "%-7s %-25.25s %-10.10s %4s %6s%s %-8.8s %-40.40s",
+    mvprintw(row++, 0, "%-7s %-25.25s %-10.10s %4s %6s %-8.8s %-40.40s",
              "PID", "processname", "user", "CPU%", "mem(MB)", "status", "command");
     attroff(COLOR_PAIR(6));
 
@@ -334,19 +357,19 @@ void DashboardNcurses::updateProcesses()
     for (size_t i = start_idx; i < end_idx; i++)
     {
         const auto &process = processes[i];
-        // NULL 체크를 추가하여 안전하게 문자열 처리
-        const char *name = process.name.empty() ? "" : process.name.c_str();
-        const char *user = process.user.empty() ? "" : process.user.c_str();
-        const char *status = process.status.empty() ? "" : process.status.c_str();
+        // 사용자, 상태는 인터닝된 string_view이므로 NUL 종료에 의존하지 않도록 길이를 함께 넘김
         const char *command = process.command.empty() ? "" : process.command.c_str();
+        int name_len = static_cast<int>(min<size_t>(process.name.size(), 25));
+        int user_len = static_cast<int>(min<size_t>(process.user.size(), 10));
+        int status_len = static_cast<int>(min<size_t>(process.status.size(), 8));
 
-        mvprintw(row++, 0, "%-7d %-25.25s %-10.10s %4.1f%% %6zu%s %-8.8s %-40.40s",
+        mvprintw(row++, 0, "%-7d %-25.*s %-10.*s %4.1f%% %6zu %-8.*s %-40.40s",
                  process.pid,
-                 name,
-                 user,
+                 name_len, process.name.data(),
+                 user_len, process.user.data(),
                  process.cpu_usage,
                  process.memory_rss,
-                 status,
+                 status_len, process.status.data(),
                  command);
     }
 
@@ -364,8 +387,9 @@ void DashboardNcurses::updateProcesses()
 void DashboardNcurses::updateDocker()
 {
     LOG_INFO("UPDATE DOCKER");
-    docker_collector.collect();
-    const std::vector<DockerContainerInfo> &containers = docker_collector.getContainers();
+    collectTimed(docker_collector, "docker");
+    docker_collector.getContainers(system_metrics.docker);
+    const std::vector<DockerContainerInfo> &containers = system_metrics.docker;
 
     attron(COLOR_PAIR(1));
     mvprintw(row++, 0, getDivider("도커 컨테이너 정보").c_str());
@@ -397,6 +421,53 @@ void DashboardNcurses::updateDocker()
     LOG_INFO("END UPDATE DOCKER");
 }
 
+/**
+ * @brief 에이전트 자체 지표를 화면에 표시합니다.
+ *
+ * 수집기별 실행 횟수, 오류 수, 소요 시간, CPU 시간과 내부 큐 깊이를 표시합니다.
+ */
+void DashboardNcurses::updateAgent()
+{
+    LOG_INFO("UPDATE AGENT");
+    AgentInfo agent = SelfMetrics::instance().snapshot();
+
+    attron(COLOR_PAIR(1));
+    mvprintw(row++, 0, "%s", getDivider("에이전트 자체 지표").c_str());
+    attroff(COLOR_PAIR(1));
+    row++;
+
+    mvprintw(row++, 0, "누적 CPU 시간: %.1fms   직렬화: %lu바이트 / %lu개 스냅샷",
+             agent.cpu_time_ms, agent.bytes_serialized, agent.snapshots_serialized);
+    row++;
+
+    attron(COLOR_PAIR(6));
+    mvprintw(row++, 0, "%-10s %8s %6s %10s %10s %10s %10s %12s",
+             "collector", "runs", "errors", "last(ms)", "avg(ms)", "p95(ms)", "max(ms)", "cpu(ms)");
+    attroff(COLOR_PAIR(6));
+
+    for (const auto &collector : agent.collectors)
+    {
+        int color = collector.errors > 0 ? 4 : (collector.p95_ms > 1000.0 ? 3 : 2);
+        attron(COLOR_PAIR(color));
+        mvprintw(row++, 0, "%-10.10s %8lu %6lu %10.1f %10.1f %10.1f %10.1f %12.1f",
+                 collector.name.c_str(), collector.runs, collector.errors,
+                 collector.last_ms, collector.avg_ms, collector.p95_ms, collector.max_ms, collector.cpu_ms);
+        attroff(COLOR_PAIR(color));
+    }
+    row++;
+
+    attron(COLOR_PAIR(1));
+    mvprintw(row++, 0, "[ 내부 큐 ]");
+    attroff(COLOR_PAIR(1));
+    for (const auto &queue : agent.queues)
+    {
+        mvprintw(row++, 0, "%-10s 깊이: %lu", queue.name.c_str(), queue.depth);
+    }
+    row++;
+
+    LOG_INFO("END UPDATE AGENT");
+}
+
 /**
  * @brief 전체 화면을 업데이트합니다.
  *
@@ -435,6 +506,10 @@ void DashboardNcurses::update()
     {
         updateDocker();
     }
+    else if (view_info == 4)
+    {
+        updateAgent();
+    }
 
     // 하단 안내 메시지 (청록색)
     attron(COLOR_PAIR(1));
@@ -460,6 +535,10 @@ void DashboardNcurses::update()
     attron(COLOR_PAIR(3)); // 노란색으로 'd' 강조
     printw("d");
     attroff(COLOR_PAIR(3));
+    printw("', 에이전트 지표는 '");
+    attron(COLOR_PAIR(1)); // 청록색으로 'a' 강조
+    printw("a");
+    attroff(COLOR_PAIR(1));
     printw("'를 누르세요.");
     attroff(COLOR_PAIR(1));
 
@@ -476,6 +555,7 @@ void DashboardNcurses::update()
  * - i/I: 시스템 정보 화면으로 전환
  * - p/P: 프로세스 정보 화면으로 전환
  * - d/D: 도커 컨테이너 정보 화면으로 전환
+ * - a/A: 에이전트 자체 지표 화면으로 전환
  * - 화살표 키: 페이지 이동 및 정렬 변경
  */
 void DashboardNcurses::handleInput()
@@ -507,6 +587,11 @@ void DashboardNcurses::handleInput()
         view_info = 3;
         current_page = 0;
     }
+    else if (ch == 'a' || ch == 'A')
+    {
+        view_info = 4;
+        current_page = 0;
+    }
     else if (ch == KEY_LEFT && view_info == 2)
     {
         if (current_page > 0)
@@ -8,6 +8,89 @@
 using namespace std;
 using json = nlohmann::json;
 
+/**
+ * @brief PSI 한 줄(some 또는 full)을 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param stat 변환할 PSI 값 구조체
+ */
+void to_json(json &j, const PressureStat &stat)
+{
+    j = {
+        {"avg10", stat.avg10},
+        {"avg60", stat.avg60},
+        {"avg300", stat.avg300},
+        {"total", stat.total},
+        {"delta", stat.delta},
+        {"stall_percent", stat.stall_percent}};
+}
+
+/**
+ * @brief 자원 하나의 압력 정보를 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param pressure 변환할 자원 압력 구조체
+ */
+void to_json(json &j, const ResourcePressure &pressure)
+{
+    j = {
+        {"some", pressure.some},
+        {"full", pressure.full}};
+}
+
+/**
+ * @brief 코어별 실행 대기 정보를 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param core 변환할 코어 스케줄러 정보 구조체
+ */
+void to_json(json &j, const SchedCoreInfo &core)
+{
+    j = {
+        {"id", core.id},
+        {"run_time", core.run_time},
+        {"wait_time", core.wait_time},
+        {"timeslices", core.timeslices},
+        {"wait_ratio", core.wait_ratio}};
+}
+
+/**
+ * @brief 자원 압력과 스케줄러 정보를 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param pressure 변환할 압력 정보 구조체
+ */
+void to_json(json &j, const PressureInfo &pressure)
+{
+    j = {
+        {"available", pressure.available},
+        {"cpu", pressure.cpu},
+        {"memory", pressure.memory},
+        {"io", pressure.io},
+        {"cores", pressure.cores}};
+}
+
+/**
+ * @brief CPU 시간 항목별 비율을 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param times 변환할 CPU 시간 비율 구조체
+ */
+void to_json(json &j, const CpuTimes &times)
+{
+    j = {
+        {"user", times.user},
+        {"nice", times.nice},
+        {"system", times.system},
+        {"idle", times.idle},
+        {"iowait", times.iowait},
+        {"irq", times.irq},
+        {"softirq", times.softirq},
+        {"steal", times.steal},
+        {"guest", times.guest},
+        {"guest_nice", times.guest_nice}};
+}
+
 /**
  * @brief CPU 코어 정보를 JSON으로 변환
  *
@@ -19,7 +102,9 @@ void to_json(json &j, const CpuCoreInfo &core)
     j = {
         {"id", core.id},
         {"usage", core.usage},
-        {"temperature", core.temperature}};
+        {"temperature", core.temperature},
+        {"speed", core.speed},
+        {"times", core.times}};
 }
 
 /**
@@ -56,6 +141,7 @@ void to_json(json &j, const CpuInfo &cpu)
         {"vendor", cpu.vendor},
         {"architecture", cpu.architecture},
         {"usage", cpu.usage},
+        {"times", cpu.times},
         {"temperature", cpu.temperature},
         {"total_cores", cpu.total_cores},
         {"total_logical_cores", cpu.total_logical_cores},
@@ -185,6 +271,23 @@ void to_json(json &j, const NetworkInterface &network)
         {"connection_type", network.connection_type}};
 }
 
+/**
+ * @brief 스레드 정보를 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param thread 변환할 스레드 정보 구조체
+ */
+void to_json(json &j, const ThreadInfo &thread)
+{
+    j = {
+        {"tid", thread.tid},
+        {"name", thread.name},
+        {"status", thread.status},
+        {"cpu_usage", thread.cpu_usage},
+        {"cpu_core_usage", thread.cpu_core_usage},
+        {"cpu_time", thread.cpu_time}};
+}
+
 /**
  * @brief 프로세스 정보를 JSON으로 변환
  *
@@ -199,6 +302,7 @@ void to_json(json &j, const ProcessInfo &process)
         {"name", process.name},
         {"status", process.status},
         {"cpu_usage", process.cpu_usage},
+        {"cpu_core_usage", process.cpu_core_usage},
         {"memory_rss", process.memory_rss},
         {"memory_vsz", process.memory_vsz},
         {"threads", process.threads},
@@ -210,6 +314,50 @@ void to_json(json &j, const ProcessInfo &process)
         {"io_write_bytes", process.io_write_bytes},
         {"open_files", process.open_files},
         {"nice", process.nice}};
+
+    // 스레드 단위 수집 대상이 아닌 프로세스는 키를 생략해 전송량을 늘리지 않음
+    if (!process.thread_details.empty())
+    {
+        j["thread_details"] = process.thread_details;
+    }
+}
+
+/**
+ * @brief 프로세스 트리/cgroup 합산 정보를 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param group 변환할 프로세스 그룹 정보 구조체
+ */
+void to_json(json &j, const ProcessGroupInfo &group)
+{
+    j = {
+        {"id", group.id},
+        {"name", group.name},
+        {"process_count", group.process_count},
+        {"threads", group.threads},
+        {"cpu_usage", group.cpu_usage},
+        {"memory_rss", group.memory_rss},
+        {"io_read_bytes", group.io_read_bytes},
+        {"io_write_bytes", group.io_write_bytes}};
+}
+
+/**
+ * @brief 프로세스 생명주기 이벤트를 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param event 변환할 프로세스 이벤트 구조체
+ */
+void to_json(json &j, const ProcessEventInfo &event)
+{
+    j = {
+        {"type", event.type},
+        {"time", event.time},
+        {"pid", event.pid},
+        {"ppid", event.ppid},
+        {"name", event.name},
+        {"exit_code", event.exit_code},
+        {"exit_signal", event.exit_signal},
+        {"runtime", event.runtime}};
 }
 
 /**
@@ -350,6 +498,60 @@ void to_json(json &j, const ServiceInfo &service)
         {"cpu_usage", service.cpu_usage}};
 }
 
+/**
+ * @brief 수집기 실행 통계를 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param stats 변환할 수집기 실행 통계 구조체
+ */
+void to_json(json &j, const CollectorStats &stats)
+{
+    j = {
+        {"name", stats.name},
+        {"runs", stats.runs},
+        {"errors", stats.errors},
+        {"last_ms", stats.last_ms},
+        {"avg_ms", stats.avg_ms},
+        {"max_ms", stats.max_ms},
+        {"p95_ms", stats.p95_ms},
+        {"cpu_ms", stats.cpu_ms},
+        {"period_ms", stats.period_ms},
+        {"latency_histogram", stats.latency_histogram}};
+}
+
+/**
+ * @brief 내부 큐 상태를 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param stats 변환할 큐 상태 구조체
+ */
+void to_json(json &j, const QueueStats &stats)
+{
+    j = {
+        {"name", stats.name},
+        {"depth", stats.depth},
+        {"dropped", stats.dropped}};
+}
+
+/**
+ * @brief 에이전트 자체 지표를 JSON으로 변환
+ *
+ * @param j 변환된 정보가 저장될 JSON 객체
+ * @param agent 변환할 에이전트 지표 구조체
+ */
+void to_json(json &j, const AgentInfo &agent)
+{
+    j = {
+        {"cpu_time_ms", agent.cpu_time_ms},
+        {"bytes_serialized", agent.bytes_serialized},
+        {"snapshots_serialized", agent.snapshots_serialized},
+        {"tick_overruns", agent.tick_overruns},
+        {"missed_cycles", agent.missed_cycles},
+        {"rate_scale", agent.rate_scale},
+        {"collectors", agent.collectors},
+        {"queues", agent.queues}};
+}
+
 /**
  * @brief 시스템 메트릭스 전체 구조를 JSON으로 변환
  *
@@ -365,11 +567,17 @@ void to_json(json &j, const SystemMetrics &metrics)
         {"system", metrics.system},
         {"cpu", metrics.cpu},
         {"memory", metrics.memory},
+        {"pressure", metrics.pressure},
         {"disk", metrics.disk},
         {"network", metrics.network},
         {"processes", metrics.process},
+        {"process_trees", metrics.process_trees},
+        {"cgroups", metrics.cgroups},
+        {"process_events", metrics.process_events},
         {"containers", metrics.docker},
-        {"services", metrics.services}};
+        {"services", metrics.services},
+        {"stale_sections", metrics.stale_sections},
+        {"agent", metrics.agent}};
 }
 
 /**